@@ -0,0 +1,403 @@
+// vtbench.c (part of mintty)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+/*
+ * Throughput benchmark for the terminal core. Feeds files through
+ * term_write() in pty-sized chunks, calling term_paint() at a given frame
+ * rate, and reports parser and paint throughput.
+ */
+
+#include "vtstub.h"
+
+#include "termpriv.h"
+#include "charset.h"
+
+#include <time.h>
+#include <fcntl.h>
+
+static double
+now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static char *
+read_file(string name, size_t *len_p)
+{
+  FILE *f = strcmp(name, "-") ? fopen(name, "rb") : stdin;
+  if (!f) {
+    fprintf(stderr, "vtbench: %s: %s\n", name, strerror(errno));
+    exit(1);
+  }
+  size_t len = 0, size = 1 << 16;
+  char *buf = malloc(size);
+  size_t n;
+  while ((n = fread(buf + len, 1, size - len, f)) > 0) {
+    len += n;
+    if (len == size)
+      buf = renewn(buf, size *= 2);
+  }
+  if (f != stdin)
+    fclose(f);
+  *len_p = len;
+  return buf;
+}
+
+/*
+ * Print the scrollback and screen contents, one line per row, followed by
+ * a checksum over all character, attribute and line attribute values, for
+ * checking that changes to the core leave its output unchanged.
+ */
+static void
+dump(FILE *f)
+{
+  uint sum = 0;
+  void add(uint v) { sum = (sum ^ v) * 16777619; }
+  for (int y = -sblines(); y < term.rows; y++) {
+    termline *line = fetch_line(y);
+    add(line->attr & ~LATTR_BIDI);
+    for (int x = 0; x < line->cols; x++) {
+      wchar wc = cell_chr(line, x);
+      add(wc);
+      add(cell_attr(line, x));
+      char buf[8];
+      int len = wc == UCSWIDE ? 0 : cs_wcntombn(buf, &wc, sizeof buf, 1);
+      fwrite(buf, 1, len, f);
+      for (int c = x; cell_cc(line, c);) {
+        c += cell_cc(line, c);
+        wc = cell_chr(line, c);
+        add(wc);
+        len = cs_wcntombn(buf, &wc, sizeof buf, 1);
+        fwrite(buf, 1, len, f);
+      }
+    }
+    fputc(line->attr & LATTR_WRAPPED ? '\\' : '\n', f);
+    if (line->attr & LATTR_WRAPPED)
+      fputc('\n', f);
+    release_line(line);
+  }
+  fprintf(f, "checksum %08x\n", sum);
+}
+
+/*
+ * Report the space taken by the scrollback, in compressline() format and
+ * as actually stored, how long it takes to encode its lines in that
+ * format, and how long it takes to decode them from either. Lines are
+ * decoded in order and in random order, as the latter defeats the reuse
+ * of partially decompressed groups.
+ */
+static void
+report_scrollback(void)
+{
+  int lines = term.sblines;
+  if (!lines)
+    return;
+
+  sbstats st;
+  scrollback_stats(&st);
+
+  uchar **copies = newn(uchar *, lines);
+  for (int i = 0; i < lines; i++) {
+    uchar *data = scrollback_line(term.sbfirst + i);
+    int len;
+    freeline(decompressline(data, &len));
+    copies[i] = memcpy(malloc(len), data, len);
+  }
+
+  termline **decoded = newn(termline *, lines);
+  for (int i = 0; i < lines; i++)
+    decoded[i] = decompressline(copies[i], null);
+  uchar *buf = 0;
+  int size = 0;
+  double t = now();
+  for (int i = 0; i < lines; i++)
+    compressline(decoded[i], &buf, &size);
+  double encode_time = now() - t;
+  free(buf);
+  for (int i = 0; i < lines; i++)
+    freeline(decoded[i]);
+  free(decoded);
+
+  t = now();
+  for (int i = 0; i < lines; i++)
+    freeline(decompressline(copies[i], null));
+  double rle_time = now() - t;
+
+  t = now();
+  for (int i = 0; i < lines; i++)
+    freeline(decompressline(scrollback_line(term.sbfirst + i), null));
+  double seq_time = now() - t;
+
+  srand(1);
+  t = now();
+  for (int i = 0; i < lines; i++) {
+    int n = term.sbfirst + rand() % lines;
+    freeline(decompressline(scrollback_line(n), null));
+  }
+  double rand_time = now() - t;
+
+  for (int i = 0; i < lines; i++)
+    free(copies[i]);
+  free(copies);
+
+  printf("sb:      %d lines, %.1f bytes/line RLE, %.1f bytes/line stored, "
+         "%.1f%% deduplicated\n",
+         lines, (double)st.rle_bytes / lines,
+         (double)st.stored_bytes / lines, 100.0 * st.dedup_lines / lines);
+  printf("encode:  %.0f ns/line RLE\n", encode_time / lines * 1e9);
+  printf("decode:  %.0f ns/line RLE, %.0f ns/line stored in order, "
+         "%.0f ns/line stored at random\n",
+         rle_time / lines * 1e9, seq_time / lines * 1e9,
+         rand_time / lines * 1e9);
+}
+
+/*
+ * Report how many of the line structures and cell arrays made during the
+ * run were taken from the line pools rather than allocated afresh.
+ */
+static void
+report_pools(void)
+{
+  poolstats st;
+  line_pool_stats(&st);
+  unsigned long lines = st.line_hits + st.line_misses;
+  unsigned long arrays = st.cells_hits + st.cells_misses;
+  printf("pools:   %lu lines, %.1f%% reused; %lu cell arrays, %.1f%% reused\n",
+         lines, lines ? 100.0 * st.line_hits / lines : 0,
+         arrays, arrays ? 100.0 * st.cells_hits / arrays : 0);
+}
+
+/*
+ * Select everything and report how long it takes to copy it.
+ */
+static void
+report_copy(void)
+{
+  double t = now();
+  term_select_all();
+  term_copy();
+  t = now() - t;
+  printf("copy:    %lu characters in %.3f ms, checksum %08x\n",
+         stats.copy_chars, t * 1e3, stats.copy_sum);
+}
+
+/*
+ * Count the matches for a search text by stepping backwards through them
+ * from the bottom of the screen, and report how long that took.
+ */
+static void
+report_search(string text)
+{
+  int len = strlen(text);
+  wchar wtext[len];
+  for (int i = 0; i < len; i++)
+    wtext[i] = (uchar)text[i];
+
+  int matches = 0;
+  pos start = {term.rows, 0}, end;
+  double t = now(), first = 0;
+  while (term_search(wtext, len, false, true, &start, &end)) {
+    if (!matches++)
+      first = now() - t;
+  }
+  t = now() - t;
+  printf("search:  %d matches for \"%s\", %.3f ms to the first, "
+         "%.3f ms in total\n", matches, text, first * 1e3, t * 1e3);
+}
+
+/*
+ * Likewise for a regular expression, which is matched in a single scan.
+ * Starting the search only holds up the caller while the screen is scanned.
+ */
+static void
+report_regex_search(string pattern)
+{
+  search_match *matches;
+  double t = now();
+  if (term_search_regex_start(pattern, false) < 0) {
+    fprintf(stderr, "vtbench: invalid regular expression\n");
+    exit(1);
+  }
+  double started = now() - t;
+  int count = term_search_regex_finish(&matches);
+  t = now() - t;
+  uint sum = 0;
+  for (int i = 0; i < count; i++) {
+    search_match *m = &matches[i];
+    sum = (sum ^ m->start.y ^ m->start.x << 20 ^ m->end.x << 10) * 16777619;
+  }
+  free(matches);
+  printf("regex:   %d matches for \"%s\" in %.3f ms (%.3f ms to start), "
+         "checksum %08x\n", count, pattern, t * 1e3, started * 1e3, sum);
+}
+
+static no_return
+usage(void)
+{
+  fputs(
+    "Usage: vtbench [OPTION]... FILE...\n"
+    "Feed FILEs (- for stdin) through the terminal emulator core.\n"
+    "\n"
+    "  -r ROWS      Screen height (default 24)\n"
+    "  -c COLS      Screen width (default 80)\n"
+    "  -s LINES     Scrollback lines (default 10000)\n"
+    "  -S BYTES     Scrollback byte limit (default none)\n"
+    "  -m BYTES     Spill scrollback beyond BYTES to a temporary file\n"
+    "  -f FPS       Paint frame rate, 0 to paint only at the end (default 60)\n"
+    "  -p CHUNKS    Paint after every CHUNKS chunks instead, for repeatable runs\n"
+    "  -v LINES     Keep the view scrolled back LINES lines while painting\n"
+    "  -n COUNT     Repeat the input COUNT times (default 1)\n"
+    "  -b BYTES     Chunk size for term_write (default 4096)\n"
+    "  -d FILE      Dump scrollback and screen contents to FILE at the end\n"
+    "  -z           Report scrollback size and line decoding times\n"
+    "  -a           Report how often lines are reused from the line pools\n"
+    "  -k           Select and copy everything at the end and report the time\n"
+    "  -q TEXT      Search for ASCII TEXT at the end and report the time taken\n"
+    "  -Q REGEX     Likewise for an extended regular expression\n"
+    "  -x FILE      Export scrollback and screen to FILE at the end\n"
+    "  -X FORMAT    Export format: text, sgr or html (default text)\n",
+    stderr
+  );
+  exit(2);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int rows = 24, cols = 80, sb_lines = 10000, repeat = 1, chunk = 4096;
+  int paint_chunks = 0, view = 0, sb_bytes = 0, sb_memory = 0;
+  double fps = 60;
+  string dump_file = 0;
+  bool sb_report = false, pool_report = false, copy_report = false;
+  string search_text = 0, search_regex = 0, export_file = 0;
+  export_format export_fmt = EXPORT_TEXT;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "r:c:s:S:m:f:p:v:n:b:d:zakq:Q:x:X:")) != -1) {
+    switch (opt) {
+      when 'r': rows = atoi(optarg);
+      when 'c': cols = atoi(optarg);
+      when 's': sb_lines = atoi(optarg);
+      when 'S': sb_bytes = atoi(optarg);
+      when 'm': sb_memory = atoi(optarg);
+      when 'f': fps = atof(optarg);
+      when 'p': paint_chunks = atoi(optarg);
+      when 'v': view = atoi(optarg);
+      when 'n': repeat = atoi(optarg);
+      when 'b': chunk = atoi(optarg);
+      when 'd': dump_file = optarg;
+      when 'z': sb_report = true;
+      when 'a': pool_report = true;
+      when 'k': copy_report = true;
+      when 'q': search_text = optarg;
+      when 'Q': search_regex = optarg;
+      when 'x': export_file = optarg;
+      when 'X':
+        if (!strcmp(optarg, "text"))
+          export_fmt = EXPORT_TEXT;
+        else if (!strcmp(optarg, "sgr"))
+          export_fmt = EXPORT_SGR;
+        else if (!strcmp(optarg, "html"))
+          export_fmt = EXPORT_HTML;
+        else
+          usage();
+      otherwise: usage();
+    }
+  }
+  if (optind == argc || rows < 1 || cols < 1 || chunk < 1 || repeat < 1)
+    usage();
+
+  stub_init(rows, cols, sb_lines);
+  cfg.scrollback_bytes = sb_bytes;
+  cfg.scrollback_memory = sb_memory;
+  cs_init();
+  term_reset();
+  term_resize(rows, cols);
+
+  double frame = fps > 0 ? 1 / fps : 0;
+  unsigned long bytes = 0, paints = 0, chunks = 0;
+  double parse_time = 0, paint_time = 0;
+  double start = now(), next_paint = start + frame;
+
+  void paint(void) {
+    double t = now();
+    if (view && !term.disptop)
+      term_scroll(-1, -view);
+    term_paint();
+    stats.update_pending = false;
+    paint_time += now() - t;
+    paints++;
+  }
+
+  for (int i = optind; i < argc; i++) {
+    size_t len;
+    char *data = read_file(argv[i], &len);
+    for (int r = 0; r < repeat; r++) {
+      for (size_t pos = 0; pos < len; pos += chunk) {
+        uint n = min((size_t)chunk, len - pos);
+        double t = now();
+        term_write(data + pos, n);
+        parse_time += now() - t;
+        bytes += n;
+        chunks++;
+        if (paint_chunks > 0) {
+          if (chunks % paint_chunks == 0 && stats.update_pending)
+            paint();
+        }
+        else if (frame && t >= next_paint) {
+          if (stats.update_pending)
+            paint();
+          next_paint = t + frame;
+        }
+      }
+    }
+    free(data);
+  }
+  paint();
+
+  double total = now() - start;
+  printf("input:   %lu bytes, %dx%d screen, %d scrollback lines\n",
+         bytes, cols, rows, sb_lines);
+  printf("total:   %.3f s\n", total);
+  printf("parse:   %.3f s, %.2f MB/s\n",
+         parse_time, bytes / 1e6 / parse_time);
+  printf("paint:   %.3f s, %lu paints, %.1f paints/s\n",
+         paint_time, paints, paints / total);
+  printf("cells:   %lu drawn in %lu runs, %.0f cells/s\n",
+         stats.text_cells, stats.text_calls, stats.text_cells / total);
+  printf("text:    checksum %08x\n", stats.text_sum);
+  if (pool_report)
+    report_pools();
+  if (sb_report)
+    report_scrollback();
+  if (copy_report)
+    report_copy();
+  if (search_text)
+    report_search(search_text);
+  if (search_regex)
+    report_regex_search(search_regex);
+
+  if (export_file) {
+    int fd = open(export_file, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    double t = now();
+    if (fd < 0 || !term_export(fd, export_fmt)) {
+      fprintf(stderr, "vtbench: %s: %s\n", export_file, strerror(errno));
+      return 1;
+    }
+    close(fd);
+    printf("export:  %.3f s\n", now() - t);
+  }
+
+  if (dump_file) {
+    FILE *f = fopen(dump_file, "w");
+    if (!f) {
+      fprintf(stderr, "vtbench: %s: %s\n", dump_file, strerror(errno));
+      return 1;
+    }
+    dump(f);
+    fclose(f);
+  }
+  return 0;
+}
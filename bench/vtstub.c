@@ -0,0 +1,329 @@
+// vtstub.c (part of mintty)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+/*
+ * Stub window, child and printer back-ends for running the terminal core
+ * without a Windows desktop. Output to the child is dropped, and text
+ * drawing just counts what would have been drawn. Also provides the Win32
+ * code page functions declared in headless.h, for UTF-8 and single-byte
+ * code pages.
+ */
+
+#include "vtstub.h"
+
+#include "win.h"
+#include "child.h"
+#include "print.h"
+#include "charset.h"
+
+#include <time.h>
+
+config cfg, new_cfg;
+
+bool font_ambig_wide;
+
+vtstats stats;
+
+static colour colours[COLOUR_NUM];
+
+wchar win_linedraw_chars[31] = {
+  0x25C6, 0x2592, 0x2409, 0x240C, 0x240D, 0x240A, 0x00B0, 0x00B1,
+  0x2424, 0x240B, 0x2518, 0x2510, 0x250C, 0x2514, 0x253C, 0x23BA,
+  0x23BB, 0x2500, 0x23BC, 0x23BF, 0x251C, 0x2524, 0x2534, 0x252C,
+  0x2502, 0x2264, 0x2265, 0x03C0, 0x2260, 0x00A3, 0x00B7
+};
+
+void
+stub_init(int rows, int cols, int scrollback_lines)
+{
+  cfg = (config){
+    .fg_colour = 0xBFBFBF, .bg_colour = 0x000000, .cursor_colour = 0xBFBFBF,
+    .cursor_blinks = true,
+    .locale = "", .charset = "",
+    .cols = cols, .rows = rows,
+    .scrollback_lines = scrollback_lines,
+    .term = "xterm", .answerback = "", .printer = "",
+    .word_chars = "",
+  };
+  new_cfg = cfg;
+  memset(&stats, 0, sizeof stats);
+}
+
+
+/* Window */
+
+void win_reconfig(void) {}
+
+void
+win_update(void)
+{
+  stats.update_pending = true;
+}
+
+void
+win_schedule_update(void)
+{
+  stats.update_pending = true;
+}
+
+void
+win_text(int x, int y, wchar *text, int len, uint attr, int lattr)
+{
+  stats.text_calls++;
+  stats.text_cells += len;
+  void add(uint v) { stats.text_sum = (stats.text_sum ^ v) * 16777619; }
+  add(x); add(y); add(attr); add(lattr & LATTR_MODE);
+  for (int i = 0; i < len; i++)
+    add(text[i]);
+}
+
+void win_update_mouse(void) {}
+void win_capture_mouse(void) {}
+void win_bell(void) {}
+
+void win_set_title(char *unused(title)) {}
+void win_save_title(void) {}
+void win_restore_title(void) {}
+
+colour win_get_colour(colour_i i) { return i < COLOUR_NUM ? colours[i] : 0; }
+void win_set_colour(colour_i i, colour c) { if (i < COLOUR_NUM) colours[i] = c; }
+void win_reset_colours(void) { memset(colours, 0, sizeof colours); }
+colour win_get_sys_colour(bool fg) { return fg ? 0xBFBFBF : 0; }
+
+void
+win_invalidate_all(void)
+{
+  // Like the WM_PAINT that InvalidateRect() leads to on Windows.
+  term_invalidate(0, 0, term.cols - 1, term.rows - 1);
+  stats.update_pending = true;
+}
+
+void win_set_pos(int unused(x), int unused(y)) {}
+void win_set_chars(int unused(rows), int unused(cols)) {}
+void win_set_pixels(int unused(height), int unused(width)) {}
+void win_maximise(int unused(max)) {}
+void win_set_zorder(bool unused(top)) {}
+void win_set_iconic(bool unused(iconic)) {}
+void win_update_scrollbar(void) {}
+bool win_is_iconic(void) { return false; }
+void win_get_pos(int *xp, int *yp) { *xp = *yp = 0; }
+void win_get_pixels(int *height_p, int *width_p)
+{ *height_p = term.rows * 16; *width_p = term.cols * 8; }
+void win_get_screen_chars(int *rows_p, int *cols_p)
+{ *rows_p = term.rows; *cols_p = term.cols; }
+void win_popup_menu(void) {}
+
+void win_zoom_font(int unused(zoom)) {}
+void win_set_font_size(int unused(size)) {}
+uint win_get_font_size(void) { return 12; }
+
+void win_check_glyphs(wchar *unused(wcs), uint unused(num)) {}
+
+void win_open(wstring path) { delete(path); }
+void
+win_copy(const wchar *data, uint *attrs, int len)
+{
+  stats.copy_chars += len;
+  for (int i = 0; i < len; i++)
+    stats.copy_sum = (stats.copy_sum ^ data[i] ^ attrs[i] << 16) * 16777619;
+}
+void win_paste(void) {}
+
+void win_set_timer(void_fn unused(cb), uint unused(ticks)) {}
+
+void win_show_about(void) {}
+void win_show_error(wchar *unused(msg)) {}
+
+bool win_is_glass_available(void) { return false; }
+
+int
+get_tick_count(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+int cursor_blink_ticks(void) { return 500; }
+
+// Assume a font without dual-width glyphs, like win_char_width() does.
+int win_char_width(xchar unused(c)) { return 1; }
+
+wchar win_combine_chars(wchar unused(bc), wchar unused(cc)) { return 0; }
+
+
+/* Config */
+
+bool
+parse_colour(string s, colour *cp)
+{
+  uint r, g, b;
+  if (sscanf(s, "#%2x%2x%2x%c", &r, &g, &b, &(char){0}) != 3)
+    return false;
+  *cp = make_colour(r, g, b);
+  return true;
+}
+
+
+/* Child */
+
+void
+child_write(const char *unused(buf), uint len)
+{
+  stats.child_bytes += len;
+}
+
+void
+child_printf(const char *fmt, ...)
+{
+  va_list va;
+  va_start(va, fmt);
+  stats.child_bytes += vsnprintf(0, 0, fmt, va);
+  va_end(va);
+}
+
+void child_send(const char *buf, uint len) { child_write(buf, len); }
+void child_sendw(const wchar *unused(ws), uint len)
+{ stats.child_bytes += len; }
+
+
+/* Printer */
+
+void printer_start_job(string unused(printer_name)) {}
+void printer_write(void *unused(data), uint unused(len)) {}
+void printer_finish_job(void) {}
+
+
+/* Win32 code pages */
+
+static bool
+is_known_codepage(UINT cp)
+{
+  return cp == CP_UTF8 || cp == 437 || cp == 20127 ||
+         (cp >= 28591 && cp <= 28606);
+}
+
+BOOL
+GetCPInfo(UINT cp, CPINFO *cpi)
+{
+  if (!is_known_codepage(cp))
+    return false;
+  *cpi = (CPINFO){.MaxCharSize = cp == CP_UTF8 ? 4 : 1, .DefaultChar = "?"};
+  return true;
+}
+
+BOOL
+GetCPInfoExW(UINT cp, DWORD unused(flags), CPINFOEXW *cpi)
+{
+  if (!is_known_codepage(cp))
+    return false;
+  *cpi = (CPINFOEXW){
+    .MaxCharSize = cp == CP_UTF8 ? 4 : 1, .DefaultChar = "?",
+    .UnicodeDefaultChar = cp == CP_UTF8 ? 0xFFFD : '?',
+    .CodePage = cp
+  };
+  return true;
+}
+
+UINT GetACP(void) { return CP_UTF8; }
+UINT GetOEMCP(void) { return 437; }
+
+int
+GetLocaleInfo(LCID unused(lcid), UINT unused(type), char *unused(buf),
+              int unused(len))
+{ return 0; }
+
+LANGID GetUserDefaultUILanguage(void) { return 0; }
+LANGID GetSystemDefaultUILanguage(void) { return 0; }
+
+/*
+ * Decode UTF-8 the way Windows does: each maximal invalid or incomplete
+ * subsequence becomes one U+FFFD, and non-BMP characters become surrogate
+ * pairs. Single-byte code pages are treated as ISO-8859-1.
+ */
+int
+MultiByteToWideChar(UINT cp, DWORD unused(flags), const char *s, int len,
+                    WCHAR *ws, int wlen)
+{
+  const uchar *p = (const uchar *)s;
+  const uchar *end = p + (len < 0 ? strlen(s) + 1 : (size_t)len);
+  int n = 0;
+  void put(WCHAR wc) {
+    if (n < wlen)
+      ws[n] = wc;
+    n++;
+  }
+  while (p < end) {
+    uchar c = *p++;
+    if (cp != CP_UTF8 || c < 0x80) {
+      put(c);
+      continue;
+    }
+    int more = c >= 0xF0 && c < 0xF5 ? 3 : c >= 0xE0 ? 2 : c >= 0xC2 ? 1 : -1;
+    if (more < 0 || c >= 0xF5) {
+      put(0xFFFD);
+      continue;
+    }
+    xchar xc = c & (0x3F >> more);
+    uchar lo = 0x80, hi = 0xBF;
+    if (c == 0xE0) lo = 0xA0;
+    else if (c == 0xED) hi = 0x9F;
+    else if (c == 0xF0) lo = 0x90;
+    else if (c == 0xF4) hi = 0x8F;
+    int i;
+    for (i = 0; i < more && p < end; i++, p++) {
+      if (*p < lo || *p > hi)
+        break;
+      xc = xc << 6 | (*p & 0x3F);
+      lo = 0x80, hi = 0xBF;
+    }
+    if (i < more)
+      put(0xFFFD);
+    else if (xc >= 0x10000) {
+      put(high_surrogate(xc));
+      put(low_surrogate(xc));
+    }
+    else
+      put(xc);
+  }
+  return wlen && n > wlen ? 0 : n;
+}
+
+int
+WideCharToMultiByte(UINT cp, DWORD unused(flags), const WCHAR *ws, int wlen,
+                    char *s, int len, const char *unused(defchar),
+                    BOOL *unused(used))
+{
+  int n = 0;
+  void put(uint c) {
+    if (n < len)
+      s[n] = c;
+    n++;
+  }
+  if (wlen < 0) {
+    wlen = 0;
+    while (ws[wlen++]);
+  }
+  for (int i = 0; i < wlen; i++) {
+    xchar xc = ws[i];
+    if (cp != CP_UTF8) {
+      put(xc < 0x100 ? xc : '?');
+      continue;
+    }
+    if (is_high_surrogate(xc) && i + 1 < wlen && is_low_surrogate(ws[i + 1]))
+      xc = combine_surrogates(xc, ws[++i]);
+    if (xc < 0x80)
+      put(xc);
+    else if (xc < 0x800)
+      put(0xC0 | xc >> 6), put(0x80 | (xc & 0x3F));
+    else if (xc < 0x10000) {
+      put(0xE0 | xc >> 12), put(0x80 | (xc >> 6 & 0x3F));
+      put(0x80 | (xc & 0x3F));
+    }
+    else {
+      put(0xF0 | xc >> 18), put(0x80 | (xc >> 12 & 0x3F));
+      put(0x80 | (xc >> 6 & 0x3F)), put(0x80 | (xc & 0x3F));
+    }
+  }
+  return len && n > len ? 0 : n;
+}
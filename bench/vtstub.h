@@ -0,0 +1,21 @@
+#ifndef VTSTUB_H
+#define VTSTUB_H
+
+#include "term.h"
+
+// What the core asked the stub back-ends to do.
+typedef struct {
+  bool update_pending;         // win_update() or win_schedule_update() called
+  unsigned long text_calls;    // win_text() calls
+  unsigned long text_cells;    // characters passed to win_text()
+  uint text_sum;               // checksum over all win_text() arguments
+  unsigned long child_bytes;   // bytes sent back to the child
+  unsigned long copy_chars;    // characters passed to win_copy()
+  uint copy_sum;               // checksum over them and their attributes
+} vtstats;
+
+extern vtstats stats;
+
+void stub_init(int rows, int cols, int scrollback_lines);
+
+#endif
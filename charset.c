@@ -12,8 +12,14 @@
 #include <langinfo.h>
 #endif
 
+#ifndef HEADLESS
 #include <winbase.h>
 #include <winnls.h>
+#endif
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 static cs_mode mode = CSM_DEFAULT;
 
@@ -33,6 +39,7 @@ static wchar cp_default_wchar;
 static char cp_default_char[4];
 
 int cs_cur_max;
+bool cs_utf8;
 
 static const struct {
   ushort cp;
@@ -247,6 +254,7 @@ update_mode(void)
 {
   codepage = 
     mode == CSM_UTF8 ? CP_UTF8 : mode == CSM_OEM  ? 437 : default_codepage;
+  cs_utf8 = codepage == CP_UTF8;
 
 #if HAS_LOCALES
   bool use_default_locale = mode == CSM_DEFAULT && valid_default_locale;
@@ -410,9 +418,19 @@ cs_mbstowcs(wchar *ws, const char *s, size_t wlen)
   return MultiByteToWideChar(codepage, 0, s, -1, ws, wlen) - 1;
 }
 
+// State of the built-in UTF-8 decoder: the number of continuation bytes
+// still needed, the code point bits decoded so far, and the valid range for
+// the next byte.
+static uint utf8_need;
+static xchar utf8_xc;
+static uchar utf8_lo, utf8_hi;
+
 int
 cs_mb1towc(wchar *pwc, char c)
 {
+  if (!pwc)
+    utf8_need = 0;
+
 #if HAS_LOCALES
   if (use_locale)
     return mbrtowc(pwc, &c, 1, 0);
@@ -473,3 +491,124 @@ cs_btowc_glyph(char c)
   MultiByteToWideChar(codepage, MB_USEGLYPHCHARS, &c, 1, &wc, 1);
   return wc;
 }
+
+/*
+ * Decode UTF-8 text into UTF-16, for use while cs_utf8 is set.
+ * Decoding stops at the end of the input, in front of a control character,
+ * when there might not be enough space for another character in ws, or
+ * after an encoding error. *wlen_p is the size of ws on entry and the
+ * number of UTF-16 units written on return. Characters outside the BMP are
+ * always written as complete surrogate pairs. Returns the number of bytes
+ * consumed.
+ *
+ * *status_p is set to -1 for an encoding error, -2 if the input ended in
+ * the middle of a character, and 0 otherwise. Invalid lead bytes are
+ * consumed by the error, whereas a byte that cuts a sequence short is not,
+ * so that it can be processed afresh. A partial character is kept until
+ * the next call, or until a reset with cs_mb1towc(0, 0).
+ */
+uint
+cs_utf8_decode(const char *s, uint len, wchar *ws, uint *wlen_p, int *status_p)
+{
+  const uchar *p = (const uchar *)s, *end = p + len;
+  uint wn = 0, wlen = *wlen_p;
+  int status = 0;
+
+  while (p < end) {
+    uchar c = *p;
+
+    if (utf8_need) {
+      if (c < utf8_lo || c > utf8_hi) {
+        utf8_need = 0;
+        status = -1;
+        break;
+      }
+      p++;
+      utf8_xc = utf8_xc << 6 | (c & 0x3F);
+      utf8_lo = 0x80;
+      utf8_hi = 0xBF;
+      if (!--utf8_need) {
+        xchar xc = utf8_xc;
+        if (xc < 0x10000)
+          ws[wn++] = xc;
+        else {
+          ws[wn++] = high_surrogate(xc);
+          ws[wn++] = low_surrogate(xc);
+        }
+      }
+      continue;
+    }
+
+    if (wn + 2 > wlen)
+      break;
+
+#ifdef __SSE2__
+   /*
+    * Check sixteen bytes at a time for printable ASCII characters,
+    * which are simply widened. As in printable_run() in termout.c,
+    * flipping the top bit turns the printable range into a signed one.
+    */
+    if (sizeof(wchar) == 2 && c >= 0x20 && c < 0x7F) {
+      const __m128i flip = _mm_set1_epi8(0x80);
+      const __m128i lo = _mm_set1_epi8(0x20 - 0x80 - 1);
+      const __m128i hi = _mm_set1_epi8(0x7F - 0x80);
+      const __m128i zero = _mm_setzero_si128();
+      while (end - p >= 16 && wn + 16 <= wlen) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        __m128i f = _mm_xor_si128(v, flip);
+        __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(f, lo), _mm_cmplt_epi8(f, hi));
+        if (_mm_movemask_epi8(ok) != 0xFFFF)
+          break;
+        _mm_storeu_si128((__m128i *)(ws + wn), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i *)(ws + wn + 8), _mm_unpackhi_epi8(v, zero));
+        p += 16;
+        wn += 16;
+      }
+      if (p == end || wn + 2 > wlen)
+        break;
+      c = *p;
+    }
+#endif
+
+    if (c < 0x80) {
+      if (c < 0x20 || c == 0x7F)
+        break;
+      ws[wn++] = c;
+      p++;
+      continue;
+    }
+
+    // Lead byte. Overlong encodings, surrogates and anything beyond
+    // U+10FFFF are excluded through the range of the first continuation byte.
+    utf8_lo = 0x80;
+    utf8_hi = 0xBF;
+    if (c >= 0xC2 && c < 0xE0)
+      utf8_need = 1, utf8_xc = c & 0x1F;
+    else if (c >= 0xE0 && c < 0xF0) {
+      utf8_need = 2, utf8_xc = c & 0x0F;
+      if (c == 0xE0)
+        utf8_lo = 0xA0;
+      else if (c == 0xED)
+        utf8_hi = 0x9F;
+    }
+    else if (c >= 0xF0 && c < 0xF5) {
+      utf8_need = 3, utf8_xc = c & 0x07;
+      if (c == 0xF0)
+        utf8_lo = 0x90;
+      else if (c == 0xF4)
+        utf8_hi = 0x8F;
+    }
+    else {
+      p++;
+      status = -1;
+      break;
+    }
+    p++;
+  }
+
+  if (!status && utf8_need)
+    status = -2;
+  *wlen_p = wn;
+  *status_p = status;
+  return p - (const uchar *)s;
+}
@@ -41,12 +41,15 @@ void cs_set_mode(cs_mode);
 int cs_wcntombn(char *s, const wchar *ws, size_t len, size_t wlen);
 int cs_mbstowcs(wchar *ws, const char *s, size_t wlen);
 int cs_mb1towc(wchar *pwc, char c);
+uint cs_utf8_decode(const char *s, uint len, wchar *ws, uint *wlen_p,
+                    int *status_p);
 wchar cs_btowc_glyph(char);
 
 extern string locale_menu[];
 extern string charset_menu[];
 
 int cs_cur_max;
+extern bool cs_utf8;  // Current charset is UTF-8, so cs_utf8_decode applies.
 
 extern bool font_ambig_wide;
 
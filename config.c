@@ -80,6 +80,8 @@ const config default_cfg = {
   .word_chars = "",
   .use_system_colours = false,
   .ime_cursor_colour = DEFAULT_COLOUR,
+  .scrollback_bytes = 0,
+  .scrollback_memory = 0,
   .ansi_colours = {
     [BLACK_I]        = 0x000000,
     [RED_I]          = 0x0000BF,
@@ -190,6 +192,8 @@ options[] = {
   {"RowSpacing", OPT_INT, offcfg(row_spacing)},
   {"WordChars", OPT_STRING, offcfg(word_chars)},
   {"IMECursorColour", OPT_COLOUR, offcfg(ime_cursor_colour)},
+  {"ScrollbackBytes", OPT_INT, offcfg(scrollback_bytes)},
+  {"ScrollbackMemory", OPT_INT, offcfg(scrollback_memory)},
   
   // ANSI colours
   {"Black", OPT_COLOUR, offcfg(ansi_colours[BLACK_I])},
@@ -523,6 +527,8 @@ finish_config(void)
   cfg.rows = max(1, cfg.rows);
   cfg.cols = max(1, cfg.cols);
   cfg.scrollback_lines = max(0, cfg.scrollback_lines);
+  cfg.scrollback_bytes = max(0, cfg.scrollback_bytes);
+  cfg.scrollback_memory = max(0, cfg.scrollback_memory);
   
   // Ignore charset setting if we haven't got a locale.
   if (!*cfg.locale)
@@ -98,6 +98,8 @@ typedef struct {
   int col_spacing, row_spacing;
   string word_chars;
   colour ime_cursor_colour;
+  int scrollback_bytes;
+  int scrollback_memory;
   colour ansi_colours[16];
   // Legacy
   bool use_system_colours;
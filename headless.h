@@ -0,0 +1,73 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+/*
+ * Stand-ins for the Cygwin and Win32 declarations that the terminal core
+ * depends on, for building it as a library on non-Windows hosts.
+ * Only what the core (term*.c, charset.c, minibidi.c, xcwidth.c) needs is
+ * declared here; the implementations live in bench/vtstub.c.
+ */
+
+#include <sys/ioctl.h>
+
+// Pretend to be a Cygwin without locale support, so that charset.c and
+// term_write() go through the code page functions and xcwidth(), which
+// behave the same on every host. The C library extras are all available.
+#define CYGWIN_VERSION_DLL_MAJOR 1005
+#define CYGWIN_VERSION_API_MINOR 999
+
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+typedef unsigned int UINT;
+typedef unsigned char BYTE;
+typedef unsigned short WCHAR;  // UTF-16, like wchar_t on Cygwin
+typedef unsigned long DWORD;
+typedef unsigned long LCID;
+typedef unsigned short LANGID;
+typedef int BOOL;
+
+enum {
+  CP_ACP = 0, CP_OEMCP = 1, CP_UTF8 = 65001
+};
+
+enum {
+  LOCALE_SYSTEM_DEFAULT = 0x0800, LOCALE_USER_DEFAULT = 0x0400,
+  LOCALE_SISO639LANGNAME = 0x59, LOCALE_SISO3166CTRYNAME = 0x5A
+};
+
+enum { MB_USEGLYPHCHARS = 4 };
+
+#define IS_HIGH_SURROGATE(wc) (((wc) & 0xFC00) == 0xD800)
+
+typedef struct {
+  UINT MaxCharSize;
+  BYTE DefaultChar[2];
+  BYTE LeadByte[12];
+} CPINFO;
+
+typedef struct {
+  UINT MaxCharSize;
+  BYTE DefaultChar[2];
+  BYTE LeadByte[12];
+  WCHAR UnicodeDefaultChar;
+  UINT CodePage;
+} CPINFOEXW;
+
+BOOL GetCPInfo(UINT cp, CPINFO *);
+BOOL GetCPInfoExW(UINT cp, DWORD flags, CPINFOEXW *);
+UINT GetACP(void);
+UINT GetOEMCP(void);
+int GetLocaleInfo(LCID, UINT type, char *buf, int len);
+LANGID GetUserDefaultUILanguage(void);
+LANGID GetSystemDefaultUILanguage(void);
+int MultiByteToWideChar(UINT cp, DWORD flags, const char *s, int len,
+                        WCHAR *ws, int wlen);
+int WideCharToMultiByte(UINT cp, DWORD flags, const WCHAR *ws, int wlen,
+                        char *s, int len, const char *defchar, BOOL *used);
+
+#endif
@@ -0,0 +1,3100 @@
+// Generated by tools/mkparsetab.c. Do not edit.
+
+static const uchar parse_table[12][256] = {
+  [NORMAL] = {
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+    A_PRINT | NORMAL << 4,
+  },
+  [ESCAPE] = {
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_DCS_ENTER | DCS_STRING << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_CSI_ENTER | CSI_ARGS << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_OSC_ENTER | OSC_START << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_IGNORE | ESCAPE << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+  },
+  [ESC_INTERMEDIATE] = {
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_EXECUTE | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_IGNORE | ESC_INTERMEDIATE << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+  },
+  [CSI_ARGS] = {
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_EXECUTE | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_CSI_PARAM | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_COLLECT | CSI_ARGS << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_CSI_DISPATCH | NORMAL << 4,
+    A_IGNORE | CSI_ARGS << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+  },
+  [OSC_START] = {
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | CMD_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | OSC_PALETTE << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_OSC_PALETTE_RESET | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+  },
+  [OSC_NUM] = {
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_OSC_NUM | OSC_NUM << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | CMD_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+  },
+  [OSC_PALETTE] = {
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_OSC_PALETTE_PUT | OSC_PALETTE << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+    A_REPROCESS | NORMAL << 4,
+  },
+  [CMD_STRING] = {
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_DISPATCH | NORMAL << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | CMD_ESCAPE << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+    A_CMD_PUT | CMD_STRING << 4,
+  },
+  [CMD_ESCAPE] = {
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_EXECUTE | CMD_ESCAPE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_COLLECT | ESC_INTERMEDIATE << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_DCS_ENTER | DCS_STRING << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_CSI_ENTER | CSI_ARGS << 4,
+    A_CMD_DISPATCH | NORMAL << 4,
+    A_OSC_ENTER | OSC_START << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_ESC_DISPATCH | NORMAL << 4,
+    A_IGNORE | CMD_ESCAPE << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | NORMAL << 4,
+  },
+  [DCS_STRING] = {
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | CMD_ESCAPE << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_IGNORE | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+    A_CMD_PUT | DCS_STRING << 4,
+  },
+  [IGNORE_STRING] = {
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+    A_IGNORE | IGNORE_STRING << 4,
+  },
+  [SOS_STRING] = {
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | NORMAL << 4,
+    A_EXECUTE | ESCAPE << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+    A_IGNORE | SOS_STRING << 4,
+  },
+};
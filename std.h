@@ -1,7 +1,11 @@
 #ifndef STD_H
 #define STD_H
 
+#ifdef HEADLESS
+#include "headless.h"
+#else
 #include <cygwin/version.h>
+#endif
 
 #include <assert.h>
 #include <limits.h>
@@ -45,7 +49,9 @@ char *asform(const char *fmt, ...);
 #define _WIN32_WINNT WINVER
 #define _WIN32_IE WINVER
 
+#ifndef HEADLESS
 #include <windef.h>
+#endif
 
 #ifdef DMALLOC
 #include <dmalloc.h>
@@ -63,7 +69,11 @@ typedef unsigned int uint;
 typedef void (*void_fn)(void);
 
 typedef uint xchar;     // UTF-32
+#ifdef HEADLESS
+typedef WCHAR wchar;    // UTF-16
+#else
 typedef wchar_t wchar;  // UTF-16
+#endif
 
 typedef const char *string;
 typedef const wchar *wstring;
@@ -79,10 +79,14 @@ int
 term_last_nonempty_line(void)
 {
   for (int i = term.rows - 1; i >= 0; i--) {
-    termline *line = term.lines[i];
-    if (line) {
+    termline *line = term_line_slot(i);
+    if (line->cleared) {
+      if (line->erase_attr != term.erase_char.attr)
+        return i;
+    }
+    else {
       for (int j = 0; j < line->cols; j++)
-        if (!termchars_equal(&line->chars[j], &term.erase_char))
+        if (!termchar_is(line, j, &term.erase_char))
           return i;
     }
   }
@@ -151,6 +155,7 @@ term_reset(void)
   term_schedule_tblink();
   term_schedule_cblink();
   term_clear_scrollback();
+  term_damage_all();
   
   win_reset_colours();
 }
@@ -202,62 +207,13 @@ term_reconfig(void)
     term.vt220_keys = strstr(new_cfg.term, "vt220");
 }
 
-static void
-scrollback_push(uchar *line)
-{
-  if (term.sblines == term.sblen) {
-    // Need to make space for the new line.
-    if (term.sblen < cfg.scrollback_lines) {
-      // Expand buffer
-      assert(term.sbpos == 0);
-      int new_sblen = min(cfg.scrollback_lines, term.sblen * 3 + 1024);
-      term.scrollback = renewn(term.scrollback, new_sblen);
-      term.sbpos = term.sblen;
-      term.sblen = new_sblen;
-    }
-    else if (term.sblines) {
-      // Throw away the oldest line
-      free(term.scrollback[term.sbpos]);
-      term.sblines--;
-    }
-    else
-      return;
-  }
-  assert(term.sblines < term.sblen);
-  assert(term.sbpos < term.sblen);
-  term.scrollback[term.sbpos++] = line;
-  if (term.sbpos == term.sblen)
-    term.sbpos = 0;
-  term.sblines++;
-  if (term.tempsblines < term.sblines)
-    term.tempsblines++;
-}
-
-static uchar *
-scrollback_pop(void)
-{
-  assert(term.sblines > 0);
-  assert(term.sbpos < term.sblen);
-  term.sblines--;
-  if (term.tempsblines)
-    term.tempsblines--;
-  if (term.sbpos == 0)
-    term.sbpos = term.sblen;
-  return term.scrollback[--term.sbpos];
-}
-
 /*
  * Clear the scrollback.
  */
 void
 term_clear_scrollback(void)
 {
-  while (term.sblines)
-    free(scrollback_pop());
-  free(term.scrollback);
-  term.scrollback = 0;
-  term.sblen = term.sblines = term.sbpos = 0;
-  term.tempsblines = 0;
+  scrollback_clear();
   term.disptop = 0;
 }
 
@@ -295,57 +251,69 @@ term_resize(int newrows, int newcols)
   *    away.
   */
 
-  termlines *lines = term.lines;
   term_cursor *curs = &term.curs;
   term_cursor *saved_curs = &term.saved_cursors[term.on_alt_screen];
 
+  // Undo the screen's rotation, so that the code below can treat it as a
+  // plain array.
+  if (term.lines_top) {
+    termline *rotated[term.rows];
+    for (int i = 0; i < term.rows; i++)
+      rotated[i] = term_line_slot(i);
+    memcpy(term.lines, rotated, sizeof rotated);
+    term.lines_top = 0;
+  }
+
+  // Rewrap the screen if the width changes, which can change the number of
+  // lines it takes. The scrollback is rewrapped lazily, see termreflow.c.
+  int rows = term.rows;
+  if (rows && newcols != term.cols)
+    rows = reflow_screen(newcols);
+
+  termlines *lines = term.lines;
+
   // Shrink the screen if newrows < rows
-  if (newrows < term.rows) {
-    int removed = term.rows - newrows;
-    int destroy = min(removed, term.rows - (curs->y + 1));
+  if (newrows < rows) {
+    int removed = rows - newrows;
+    int destroy = min(removed, rows - (curs->y + 1));
     int store = removed - destroy;
     
     // Push removed lines into scrollback
-    for (int i = 0; i < store; i++) {
-      termline *line = lines[i];
-      scrollback_push(compressline(line));
-      freeline(line);
-    }
+    for (int i = 0; i < store; i++)
+      freeline(scrollback_push(lines[i]));
 
     // Move up remaining lines
     memmove(lines, lines + store, newrows * sizeof(termline *));
     
     // Destroy removed lines below the cursor
-    for (int i = term.rows - destroy; i < term.rows; i++)
+    for (int i = rows - destroy; i < rows; i++)
       freeline(lines[i]);
     
-    // Adjust cursor position
+    // Adjust cursor position. Rewrapping can put the saved cursor below
+    // the cursor, on a line that has been destroyed.
     curs->y = max(0, curs->y - store);
-    saved_curs->y = max(0, saved_curs->y - store);
+    saved_curs->y = min(max(0, saved_curs->y - store), newrows - 1);
   }
 
   term.lines = lines = renewn(lines, newrows);
   
   // Expand the screen if newrows > rows
-  if (newrows > term.rows) {
-    int added = newrows - term.rows;
+  if (newrows > rows) {
+    int added = newrows - rows;
+    scrollback_reflow(added, newcols);
     int restore = min(added, term.tempsblines);
     int create = added - restore;
     
     // Fill bottom of screen with blank lines
     for (int i = newrows - create; i < newrows; i++)
-      lines[i] = newline(newcols, false);
+      lines[i] = blank_line(newcols, ATTR_DEFAULT);
     
     // Move existing lines down
-    memmove(lines + restore, lines, term.rows * sizeof(termline *));
+    memmove(lines + restore, lines, rows * sizeof(termline *));
     
     // Restore lines from scrollback
     for (int i = restore; i--;) {
-      uchar *cline = scrollback_pop();
-      termline *line = decompressline(cline, null);
-      free(cline);
-      line->temporary = false;  /* reconstituted line is now real */
-      lines[i] = line;
+      lines[i] = scrollback_pop();
     }
     
     // Adjust cursor position
@@ -354,23 +322,36 @@ term_resize(int newrows, int newcols)
   }
   
   // Resize lines
-  for (int i = 0; i < newrows; i++)
-    resizeline(lines[i], newcols);
+  for (int i = 0; i < newrows; i++) {
+    if (lines[i]->shared)
+      lines[i] = blank_line(newcols, lines[i]->erase_attr);
+    else
+      resizeline(lines[i], newcols);
+  }
   
+  // The display buffer is started afresh, but its lines can be reused if
+  // the width stays the same, which saves reallocating everything when
+  // only the height changes. Others are shared blank lines until painted.
+  int keep = newcols == term.cols ? min(term.rows, newrows) : 0;
+
   // Make a new displayed text buffer.
   if (term.displines) {
-    for (int i = 0; i < term.rows; i++)
+    for (int i = keep; i < term.rows; i++)
       freeline(term.displines[i]);
   }
   term.displines = renewn(term.displines, newrows);
   for (int i = 0; i < newrows; i++) {
-    termline *line = newline(newcols, false);
-    term.displines[i] = line;
-    for (int j = 0; j < newcols; j++)
-      line->chars[j].attr = ATTR_INVALID;
+    termline *line = i < keep ? term.displines[i] : 0;
+    if (line && !line->shared) {
+      for (int j = 0; j < newcols; j++)
+        cell_attr(line, j) = ATTR_INVALID;
+    }
+    else
+      term.displines[i] = blank_line(newcols, ATTR_INVALID);
   }
 
-  // Make a new alternate screen.
+  // Make a new alternate screen. Its lines only get allocated once
+  // something is written to them.
   lines = term.other_lines;
   if (lines) {
     for (int i = 0; i < term.rows; i++)
@@ -378,7 +359,8 @@ term_resize(int newrows, int newcols)
   }
   term.other_lines = lines = renewn(lines, newrows);
   for (int i = 0; i < newrows; i++)
-    lines[i] = newline(newcols, true);
+    lines[i] = blank_line(newcols, term.erase_char.attr);
+  term.other_lines_top = 0;
 
   // Reset tab stops
   term.tabs = renewn(term.tabs, newcols);
@@ -397,6 +379,18 @@ term_resize(int newrows, int newcols)
   term.rows = newrows;
   term.cols = newcols;
 
+  term.dirty = renewn(term.dirty, newrows);
+  term_damage_all();
+
+  // Cached scrollback lines have the old width.
+  sbcache_clear();
+  term.sbcache_size = newrows * 2;
+  term.sbcache = renewn(term.sbcache, term.sbcache_size);
+  for (int i = 0; i < term.sbcache_size; i++)
+    term.sbcache[i].line = 0;
+
+  trim_blank_lines(newcols);
+
   term_switch_screen(on_alt_screen, false);
 }
 
@@ -417,6 +411,10 @@ term_switch_screen(bool to_alt, bool reset)
   termlines *oldlines = term.lines;
   term.lines = term.other_lines;
   term.other_lines = oldlines;
+  int oldtop = term.lines_top;
+  term.lines_top = term.other_lines_top;
+  term.other_lines_top = oldtop;
+  term_damage_all();
   
   if (to_alt && reset)
     term_erase(false, false, true, true);
@@ -448,14 +446,18 @@ term_check_boundary(int x, int y)
   if (x == 0 || x > term.cols)
     return;
 
-  termline *line = term.lines[y];
-  if (x == term.cols)
+  termline *line = term_line(y);
+  if (x == term.cols) {
+    if (line->attr & LATTR_WRAPPED2)
+      term_damage(y, 0, term.cols);
     line->attr &= ~LATTR_WRAPPED2;
-  else if (line->chars[x].chr == UCSWIDE) {
+  }
+  else if (cell_chr(line, x) == UCSWIDE) {
     clear_cc(line, x - 1);
     clear_cc(line, x);
-    line->chars[x - 1].chr = ' ';
-    line->chars[x] = line->chars[x - 1];
+    cell_chr(line, x - 1) = ' ';
+    set_termchar(line, x, get_termchar(line, x - 1));
+    term_damage(y, x - 1, x + 1);
   }
 }
 
@@ -474,32 +476,38 @@ term_do_scroll(int topline, int botline, int lines, bool sb)
   
   botline++; // One below the scroll region: easier to calculate with
   
+  // Scrolling the whole screen only needs to rotate it, see ring_index().
+  bool whole_screen = topline == 0 && botline == term.rows;
+
+  if (whole_screen)
+    term_damage_all();
+  else {
+    for (int y = topline; y < botline; y++)
+      term_damage(y, 0, term.cols);
+  }
+
   // Don't try to scroll more than the number of lines in the scroll region.
   int lines_in_region = botline - topline;
   lines = min(lines, lines_in_region);
   
-  // Number of lines that are moved up or down as they are.
-  // The rest are scrolled out of the region and replaced by empty lines.
-  int moved_lines = lines_in_region - lines;
-  
-  // Useful pointers to the top and (one below the) bottom lines.
-  termline **top = term.lines + topline;
-  termline **bot = term.lines + botline;
-  
-  // Reuse lines that are being scrolled out of the scroll region,
-  // clearing their content.
-  termline *recycled[abs(lines)];
-  void recycle(termline **src) {
-    memcpy(recycled, src, sizeof recycled);
-    for (int i = 0; i < lines; i++)
-      clearline(recycled[i]);
-  }
+  // Lines that are scrolled out of the scroll region are reused for the
+  // empty lines coming in at the other side.
+  termline *recycled[lines];
 
   if (down) {
     // Move down remaining lines and push in the recycled lines
-    recycle(bot - lines);
-    memmove(top + lines, top, moved_lines * sizeof(termline *));
-    memcpy(top, recycled, sizeof recycled);
+    if (whole_screen)
+      term.lines_top = ring_index(term.lines_top, term.rows - lines);
+    else {
+      for (int i = 0; i < lines; i++)
+        recycled[i] = term_line_slot(botline - lines + i);
+      for (int y = botline; --y >= topline + lines;)
+        term_line_slot(y) = term_line_slot(y - lines);
+      for (int i = 0; i < lines; i++)
+        term_line_slot(topline + i) = recycled[i];
+    }
+    for (int i = 0; i < lines; i++)
+      term_line_slot(topline + i) = clearline(term_line_slot(topline + i));
 
     // Move selection markers if they're within the scroll region
     void scroll_pos(pos *p) {
@@ -518,20 +526,35 @@ term_do_scroll(int topline, int botline, int lines, bool sb)
     // Only push lines into the scrollback when scrolling off the top of the
     // normal screen and scrollback is actually enabled.
     if (sb && topline == 0 && !term.on_alt_screen && cfg.scrollback_lines) {
+      // The scrollback takes the lines and gives back others of the
+      // same width, which are cleared below.
       for (int i = 0; i < lines; i++)
-        scrollback_push(compressline(term.lines[i]));
+        term_line_slot(i) = scrollback_push(term_line_slot(i));
  
-      // Shift viewpoint accordingly if user is looking at scrollback
-      if (term.disptop < 0)
+      // Shift viewpoint accordingly if user is looking at scrollback.
+      // Once the scrollback is full, the lines in view change instead.
+      if (term.disptop < 0) {
         term.disptop = max(term.disptop - lines, -term.sblines);
+        term_damage_all();
+      }
 
       seltop = -term.sblines;
     }
     
     // Move up remaining lines and push in the recycled lines
-    recycle(top);
-    memmove(top, top + lines, moved_lines * sizeof(termline *));
-    memcpy(bot - lines, recycled, sizeof recycled);
+    if (whole_screen)
+      term.lines_top = ring_index(term.lines_top, lines);
+    else {
+      for (int i = 0; i < lines; i++)
+        recycled[i] = term_line_slot(topline + i);
+      for (int y = topline; y < botline - lines; y++)
+        term_line_slot(y) = term_line_slot(y + lines);
+      for (int i = 0; i < lines; i++)
+        term_line_slot(botline - lines + i) = recycled[i];
+    }
+    for (int i = 0; i < lines; i++)
+      term_line_slot(botline - lines + i) =
+        clearline(term_line_slot(botline - lines + i));
 
     // Move selection markers if they're within the scroll region
     void scroll_pos(pos *p) {
@@ -593,43 +616,187 @@ term_erase(bool selective, bool line_only, bool from_begin, bool to_end)
       term.tempsblines = 0;
   }
   else {
-    termline *line = term.lines[start.y];
-    while (poslt(start, end)) {
-      if (start.x == term.cols) {
+    // Lines before the end one may have their line attributes reset too.
+    for (int y = start.y; y < end.y; y++)
+      term_damage(y, 0, term.cols);
+    if (end.y < term.rows)
+      term_damage(end.y, start.y == end.y ? start.x : 0, end.x);
+
+    // Positions run from 0 to term.cols on each line, with the last one
+    // standing for the line attributes.
+    for (int y = start.y; y <= min(end.y, term.rows - 1); y++) {
+      int left = y == start.y ? start.x : 0;
+      int right = y == end.y ? end.x : term.cols + 1;
+      if (left >= right)
+        continue;
+      termline *line = term_line_slot(y);
+      if (!selective && left == 0 && right > term.cols &&
+          line->cols <= term.cols) {
+       /* Whole lines are cleared lazily, see clearline(). */
+        int attr = line->attr;
+        line = term_line_slot(y) = clearline(line);
+        if (line->shared)
+          continue;  /* blank lines have no line attributes to change */
+        line->attr = attr;
+      }
+      else if (!line->cleared || line->erase_attr != term.erase_char.attr) {
+        line = term_line(y);
+        for (int x = left; x < min(right, term.cols); x++) {
+          if (!selective || !(cell_attr(line, x) & ATTR_PROTECTED))
+            set_termchar(line, x, term.erase_char);
+        }
+      }
+      if (right > term.cols) {
+        // Only protected characters can survive a whole-line erase,
+        // so otherwise there's nothing left that would need bidi.
+        uint keep = left || selective ? LATTR_BIDI : 0;
         if (line_only)
-          line->attr &= ~(LATTR_WRAPPED | LATTR_WRAPPED2);
+          line->attr &= LATTR_MODE | keep;
         else
-          line->attr = LATTR_NORM;
+          line->attr &= keep;
       }
-      else if (!selective || !(line->chars[start.x].attr & ATTR_PROTECTED))
-        line->chars[start.x] = term.erase_char;
-      if (incpos(start) && start.y < term.rows)
-        line = term.lines[start.y];
     }
   }
 }
 
+/*
+ * Note that columns left to right - 1 of screen line y (negative for
+ * scrollback) may have changed, so that the next term_paint() looks at them.
+ */
+void
+term_damage(int y, int left, int right)
+{
+  // If the view has moved since the last paint, everything will need to
+  // be redrawn anyway, whereas damage recorded now could end up on the
+  // wrong rows if the view moves back before the next paint.
+  if (term.disptop != term.painted.disptop) {
+    term_damage_all();
+    return;
+  }
+
+  if (term.all_dirty)
+    return;
+
+  int i = y - term.disptop;
+  if (i < 0 || i >= term.rows)
+    return;
+  left = max(left, 0);
+  right = min(right, term.cols);
+  if (left >= right)
+    return;
+  typeof(*term.dirty) *dirty = &term.dirty[i];
+  if (dirty->left >= dirty->right)
+    dirty->left = left, dirty->right = right;
+  else {
+    dirty->left = min(dirty->left, left);
+    dirty->right = max(dirty->right, right);
+  }
+}
+
+void
+term_damage_all(void)
+{
+  term.all_dirty = true;
+}
+
+/*
+ * Damage whatever is affected by changes to the view since the last paint:
+ * scrolling, selection, cursor and the various global display modes.
+ */
+static void
+damage_view(void)
+{
+  typeof(term.painted) *p = &term.painted;
+
+  if (p->disptop != term.disptop ||
+      p->show_other_screen != term.show_other_screen ||
+      p->in_vbell != term.in_vbell || p->has_focus != term.has_focus ||
+      p->tblinker != term.tblinker)
+    term_damage_all();
+  else if (p->selected != term.selected || p->sel_rect != term.sel_rect ||
+           !poseq(p->sel_start, term.sel_start) ||
+           !poseq(p->sel_end, term.sel_end)) {
+    void damage_sel(pos start, pos end) {
+      int top = max(start.y, term.disptop);
+      int bot = min(end.y, term.disptop + term.rows - 1);
+      for (int y = top; y <= bot; y++)
+        term_damage(y, 0, term.cols);
+    }
+    if (p->selected)
+      damage_sel(p->sel_start, p->sel_end);
+    if (term.selected)
+      damage_sel(term.sel_start, term.sel_end);
+  }
+
+ /* The cursor's blinking, shape and position aren't tracked otherwise. */
+  if (p->curs_y >= 0)
+    term_damage(p->curs_y, 0, term.cols);
+  int curs_y =
+    term.cursor_on && !term.show_other_screen ? term.curs.y : -1;
+  if (curs_y >= 0)
+    term_damage(curs_y, 0, term.cols);
+
+  *p = (typeof(*p)){
+    .disptop = term.disptop,
+    .curs_y = curs_y,
+    .selected = term.selected,
+    .sel_rect = term.sel_rect,
+    .sel_start = term.sel_start,
+    .sel_end = term.sel_end,
+    .show_other_screen = term.show_other_screen,
+    .in_vbell = term.in_vbell,
+    .has_focus = term.has_focus,
+    .tblinker = term.tblinker
+  };
+}
+
+/*
+ * Bring the real screen up to date with the terminal. Only rows that have
+ * been damaged since the last paint are looked at. Within a row, cells
+ * outside the damaged span are taken to look as they did last time, but
+ * the whole row still goes through the run logic below, as runs that were
+ * drawn in one go have to be redrawn in their entirety.
+ */
 void
 term_paint(void)
 {
+  if (term.disptop < 0) {
+    scrollback_reflow(-term.disptop, term.cols);
+    term.disptop = max(term.disptop, -sblines());
+  }
+
+  damage_view();
+
  /* The display line that the cursor is on, or -1 if the cursor is invisible. */
   int curs_y =
     term.cursor_on && !term.show_other_screen
     ? term.curs.y - term.disptop : -1;
 
   for (int i = 0; i < term.rows; i++) {
+    int left = term.dirty[i].left, right = term.dirty[i].right;
+    if (term.all_dirty)
+      left = 0, right = term.cols;
+    if (left >= right)
+      continue;
+    term.dirty[i].left = term.dirty[i].right = 0;
+
     pos scrpos;
     scrpos.y = i + term.disptop;
 
    /* Do Arabic shaping and bidi. */
     termline *line = fetch_line(scrpos.y);
-    termchar *chars = term_bidi_line(line, i);
-    int *backward = chars ? term.post_bidi_cache[i].backward : 0;
-    int *forward = chars ? term.post_bidi_cache[i].forward : 0;
-    chars = chars ?: line->chars;
+    termline *src = term_bidi_line(line, i);
+    int *backward = src ? term.post_bidi_cache[i].backward : 0;
+    int *forward = src ? term.post_bidi_cache[i].forward : 0;
+    src = src ?: line;
+
+   /* Reordered lines don't map damaged columns to display columns. */
+    if (backward)
+      left = 0, right = term.cols;
 
     termline *displine = term.displines[i];
-    termchar *dispchars = displine->chars;
+    if (displine->shared)
+      displine = term.displines[i] = fill_cleared(displine);
     termchar newchars[term.cols];
 
   /*
@@ -637,10 +804,16 @@ term_paint(void)
     * each character cell to look like.
     */
     for (int j = 0; j < term.cols; j++) {
-      termchar *d = chars + j;
+      if (j < left || j >= right) {
+        newchars[j].chr = cell_chr(displine, j);
+        newchars[j].attr = cell_attr(displine, j) & ~DATTR_STARTRUN;
+        newchars[j].cc_next = 0;
+        continue;
+      }
+
       scrpos.x = backward ? backward[j] : j;
-      wchar tchar = d->chr;
-      uint tattr = d->attr;
+      wchar tchar = cell_chr(src, j);
+      uint tattr = cell_attr(src, j);
       
      /* Many Windows fonts don't have the Unicode hyphen, but groff
       * uses it for man pages, so display it as the ASCII version.
@@ -648,7 +821,7 @@ term_paint(void)
       if (tchar == 0x2010)
         tchar = '-';
 
-      if (j < term.cols - 1 && d[1].chr == UCSWIDE)
+      if (j < term.cols - 1 && cell_chr(src, j + 1) == UCSWIDE)
         tattr |= ATTR_WIDE;
 
      /* Video reversing things */
@@ -672,18 +845,18 @@ term_paint(void)
       * Check the font we'll _probably_ be using to see if 
       * the character is wide when we don't want it to be.
       */
-      if (tchar != dispchars[j].chr ||
-          tattr != (dispchars[j].attr & ~(ATTR_NARROW | DATTR_MASK))) {
+      if (tchar != cell_chr(displine, j) ||
+          tattr != (cell_attr(displine, j) & ~(ATTR_NARROW | DATTR_MASK))) {
         if ((tattr & ATTR_WIDE) == 0 && win_char_width(tchar) == 2)
           tattr |= ATTR_NARROW;
       }
-      else if (dispchars[j].attr & ATTR_NARROW)
+      else if (cell_attr(displine, j) & ATTR_NARROW)
         tattr |= ATTR_NARROW;
 
      /* FULL-TERMCHAR */
       newchars[j].attr = tattr;
       newchars[j].chr = tchar;
-     /* Combining characters are still read from chars */
+     /* Combining characters are still read from src */
       newchars[j].cc_next = 0;
     }
 
@@ -695,7 +868,7 @@ term_paint(void)
       int curs_x = term.curs.x;
       if (forward)
         curs_x = forward[curs_x];
-      if (curs_x > 0 && chars[curs_x].chr == UCSWIDE)
+      if (curs_x > 0 && cell_chr(src, curs_x) == UCSWIDE)
         curs_x--;
 
      /* Determine cursor cell attributes. */
@@ -705,7 +878,7 @@ term_paint(void)
         (term.curs.wrapnext ? TATTR_RIGHTCURS : 0);
       
       if (term.cursor_invalid)
-        dispchars[curs_x].attr |= ATTR_INVALID;
+        cell_attr(displine, curs_x) |= ATTR_INVALID;
     }
 
    /*
@@ -725,22 +898,22 @@ term_paint(void)
     int laststart = 0;
     bool dirtyrect = false;
     for (int j = 0; j < term.cols; j++) {
-      if (dispchars[j].attr & DATTR_STARTRUN) {
+      if (cell_attr(displine, j) & DATTR_STARTRUN) {
         laststart = j;
         dirtyrect = false;
       }
 
-      if (dispchars[j].chr != newchars[j].chr ||
-          (dispchars[j].attr & ~DATTR_STARTRUN) != newchars[j].attr) {
+      if (cell_chr(displine, j) != newchars[j].chr ||
+          (cell_attr(displine, j) & ~DATTR_STARTRUN) != newchars[j].attr) {
         if (!dirtyrect) {
           for (int k = laststart; k < j; k++)
-            dispchars[k].attr |= ATTR_INVALID;
+            cell_attr(displine, k) |= ATTR_INVALID;
           dirtyrect = true;
         }
       }
 
       if (dirtyrect)
-        dispchars[j].attr |= ATTR_INVALID;
+        cell_attr(displine, j) |= ATTR_INVALID;
     }
 
    /*
@@ -748,7 +921,7 @@ term_paint(void)
     */
     wchar text[max(term.cols, 16)];
     int textlen = 0;
-    bool dirty_run = (line->attr != displine->attr);
+    bool dirty_run = (line->attr ^ displine->attr) & ~LATTR_BIDI;
     bool dirty_line = dirty_run;
     uint attr = 0;
     int start = 0;
@@ -756,11 +929,10 @@ term_paint(void)
     displine->attr = line->attr;
 
     for (int j = 0; j < term.cols; j++) {
-      termchar *d = chars + j;
       uint tattr = newchars[j].attr;
       wchar tchar = newchars[j].chr;
 
-      if ((dispchars[j].attr ^ tattr) & ATTR_WIDE)
+      if ((cell_attr(displine, j) ^ tattr) & ATTR_WIDE)
         dirty_line = true;
 
       bool break_run = tattr ^ attr;
@@ -768,12 +940,12 @@ term_paint(void)
      /*
       * Break on both sides of any combined-character cell.
       */
-      if (d->cc_next || (j > 0 && d[-1].cc_next))
+      if (cell_cc(src, j) || (j > 0 && cell_cc(src, j - 1)))
         break_run = true;
 
       if (!dirty_line) {
-        if (dispchars[j].chr == tchar &&
-            (dispchars[j].attr & ~DATTR_STARTRUN) == tattr)
+        if (cell_chr(displine, j) == tchar &&
+            (cell_attr(displine, j) & ~DATTR_STARTRUN) == tattr)
           break_run = true;
         else if (!dirty_run && textlen == 1)
           break_run = true;
@@ -789,40 +961,38 @@ term_paint(void)
       }
 
       bool do_copy =
-        !termchars_equal_override(&dispchars[j], d, tchar, tattr);
+        !termchars_equal_override(displine, j, src, j, tchar, tattr);
       dirty_run |= do_copy;
 
       text[textlen++] = tchar;
 
-      if (d->cc_next) {
-        termchar *dd = d;
-        while (dd->cc_next && textlen < 16) {
-          dd += dd->cc_next;
-          text[textlen++] = dd->chr;
+      if (cell_cc(src, j)) {
+        int k = j;
+        while (cell_cc(src, k) && textlen < 16) {
+          k += cell_cc(src, k);
+          text[textlen++] = cell_chr(src, k);
         }
         attr |= TATTR_COMBINING;
       }
 
       if (do_copy) {
-        copy_termchar(displine, j, d);  // may change displine->chars
-        dispchars = displine->chars;
-        dispchars[j].chr = tchar;
-        dispchars[j].attr = tattr;
+        copy_termchar(displine, j, src, j);
+        cell_chr(displine, j) = tchar;
+        cell_attr(displine, j) = tattr;
         if (start == j)
-          dispchars[j].attr |= DATTR_STARTRUN;
+          cell_attr(displine, j) |= DATTR_STARTRUN;
       }
 
      /* If it's a wide char step along to the next one. */
       if ((tattr & ATTR_WIDE) && ++j < term.cols) {
-        d++;
        /*
         * By construction above, the cursor should not
         * be on the right-hand half of this character.
         * Ever.
         */
-        if (!termchars_equal(&dispchars[j], d))
+        if (!termchars_equal(displine, j, src, j))
           dirty_run = true;
-        copy_termchar(displine, j, d);
+        copy_termchar(displine, j, src, j);
       }
     }
     if (dirty_run && textlen)
@@ -830,6 +1000,7 @@ term_paint(void)
     release_line(line);
   }
 
+  term.all_dirty = false;
   term.cursor_invalid = false;
 }
 
@@ -846,12 +1017,15 @@ term_invalidate(int left, int top, int right, int bottom)
     bottom = term.rows - 1;
 
   for (int i = top; i <= bottom && i < term.rows; i++) {
-    if ((term.displines[i]->attr & LATTR_MODE) == LATTR_NORM)
-      for (int j = left; j <= right && j < term.cols; j++)
-        term.displines[i]->chars[j].attr |= ATTR_INVALID;
-    else
-      for (int j = left / 2; j <= right / 2 + 1 && j < term.cols; j++)
-        term.displines[i]->chars[j].attr |= ATTR_INVALID;
+    termline *displine = term.displines[i];
+    int l = left, r = right;
+    if ((displine->attr & LATTR_MODE) != LATTR_NORM)
+      l = left / 2, r = right / 2 + 1;
+    if (!displine->shared) {
+      for (int j = l; j <= r && j < term.cols; j++)
+        cell_attr(displine, j) |= ATTR_INVALID;
+    }
+    term_damage(i + term.disptop, l, r + 1);
   }
 }
 
@@ -865,8 +1039,16 @@ term_invalidate(int left, int top, int right, int bottom)
 void
 term_scroll(int rel, int where)
 {
+  // Lines need rewrapping before they're shown, which can change their
+  // number, so do that first.
+  if (rel > 0 && sblines())
+    scrollback_reflow(term.sblines, term.cols);
   int sbtop = -sblines();
   term.disptop = (rel < 0 ? 0 : rel > 0 ? sbtop : term.disptop) + where;
+  if (term.disptop < 0 && sblines()) {
+    scrollback_reflow(-term.disptop, term.cols);
+    sbtop = -sblines();
+  }
   if (term.disptop < sbtop)
     term.disptop = sbtop;
   if (term.disptop > 0)
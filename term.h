@@ -110,6 +110,8 @@ enum {
   LATTR_WRAPPED2 = 0x00000020u, /* with WRAPPED: CJK wide character
                                  * wrapped to next line, so last
                                  * single-width cell is empty */
+  LATTR_BIDI     = 0x00000040u, /* may contain characters that need
+                                 * bidi reordering or Arabic shaping */
 };
 
 enum {
@@ -145,46 +147,108 @@ typedef struct {
 
 const termchar basic_erase_char;
 
+/*
+ * The cells of a line are normally stored as an array of termchars. If
+ * CELL_ARRAYS is defined, they're stored as separate arrays of
+ * attributes, characters and cc_next offsets instead, so that loops that
+ * only look at one of those, such as trimming trailing spaces or encoding
+ * attribute runs, go through contiguous memory. Either way, the three
+ * arrays share one allocation of `size' cells.
+ *
+ * Cells are accessed through the macros and functions below, which work
+ * with both layouts. termchar still serves for single cells that aren't
+ * part of a line, such as the erase character.
+ */
 typedef struct {
   ushort attr;
   ushort cols;    /* number of real columns on the line */
   ushort size;    /* number of allocated termchars
                      (cc-lists may make this > cols) */
-  bool temporary; /* true if decompressed from scrollback */
+  bool temporary; /* true if to be freed by release_line() */
+  bool cleared;   /* chars are yet to be filled in by fill_cleared() */
+  bool shared;    /* read-only blank line from blank_line() */
   short cc_free;  /* offset to first cc in free list */
+  uint erase_attr; /* attributes to fill a cleared line with */
+#ifdef CELL_ARRAYS
+  uint *attrs;
+  wchar *chrs;
+  short *ccs;
+#else
   termchar *chars;
+#endif
 } termline;
 
+#ifdef CELL_ARRAYS
+#define cell_chr(line, x) ((line)->chrs[x])
+#define cell_attr(line, x) ((line)->attrs[x])
+#define cell_cc(line, x) ((line)->ccs[x])
+#else
+#define cell_chr(line, x) ((line)->chars[x].chr)
+#define cell_attr(line, x) ((line)->chars[x].attr)
+#define cell_cc(line, x) ((line)->chars[x].cc_next)
+#endif
+
+static inline termchar
+get_termchar(termline *line, int x)
+{
+  return (termchar){
+    .cc_next = cell_cc(line, x), .chr = cell_chr(line, x),
+    .attr = cell_attr(line, x)
+  };
+}
+
+static inline void
+set_termchar(termline *line, int x, termchar c)
+{
+  cell_cc(line, x) = c.cc_next;
+  cell_chr(line, x) = c.chr;
+  cell_attr(line, x) = c.attr;
+}
+
 typedef termline *termlines;
 
 typedef struct {
   int width;
-  termchar *chars;
+  termline *line;
   int *forward, *backward;      /* the permutations of line positions */
 } bidi_cache_entry;
 
+typedef struct {
+  int n;          /* absolute number of the scrollback line */
+  uint used;      /* sbcache_clock when last fetched */
+  termline *line; /* decompressed line, or null if the entry is unused */
+} sbcache_entry;
+
 termline *newline(int cols, int bce);
 void freeline(termline *);
-void clearline(termline *);
+termline *copyline(termline *);
+termline *clearline(termline *);
+termline *fill_cleared(termline *);
+termline *blank_line(int cols, uint attr);
+void trim_blank_lines(int cols);
 void resizeline(termline *, int);
 
 int sblines(void);
 termline *fetch_line(int y);
 void release_line(termline *);
 
-int termchars_equal(termchar *a, termchar *b);
-int termchars_equal_override(termchar *a, termchar *b, uint bchr, uint battr);
+bool termchar_is(termline *, int x, termchar *c);
+bool termchars_equal(termline *a, int ax, termline *b, int bx);
+bool termchars_equal_override(termline *a, int ax, termline *b, int bx,
+                              uint bchr, uint battr);
 
-void copy_termchar(termline *destline, int x, termchar *src);
-void move_termchar(termline *line, termchar *dest, termchar *src);
+void copy_termchar(termline *destline, int x, termline *srcline, int srcx);
+void move_termchar(termline *line, int dest, int src);
 
 void add_cc(termline *, int col, wchar chr);
 void clear_cc(termline *, int col);
 
-uchar *compressline(termline *);
+int compressline(termline *, uchar **data_p, int *size_p);
 termline *decompressline(uchar *, int *bytes_used);
+void decompressline_into(uchar *, termline *);
+int decompressline_attr(uchar *);
 
-termchar *term_bidi_line(termline *, int scr_y);
+termline *term_bidi_line(termline *, int scr_y);
 
 /* Traditional terminal character sets */
 typedef enum {
@@ -224,19 +288,43 @@ struct term {
   bool show_other_screen;
 
   termlines *lines, *other_lines;
+  int lines_top, other_lines_top;  /* ring index of the top screen line */
   term_cursor curs, saved_cursors[2];
 
-  uchar **scrollback;     /* lines scrolled off top of screen */
   int disptop;            /* distance scrolled back (0 or -ve) */
-  int sblen;              /* length of scrollback buffer */
   int sblines;            /* number of lines of scrollback */
-  int sbpos;              /* index of next scrollback position to be filled */
   int tempsblines;        /* number of lines of .scrollback that
                            * can be retrieved onto the terminal
                            * ("temporary scrollback") */
+  int sbfirst;            /* absolute number of the oldest scrollback line */
+  int sbreflow;           /* absolute number of the first scrollback line
+                           * that has been rewrapped for the current width */
+
+  // Least recently used cache of decompressed scrollback lines, so that
+  // painting and selecting in the scrollback don't keep decompressing the
+  // same lines. Sized at twice the screen height.
+  sbcache_entry *sbcache;
+  int sbcache_size;
+  uint sbcache_clock;
+  int sbcache_lo, sbcache_hi;  // bounds of the line numbers in the cache
 
   termlines *displines;   /* buffer of text on real screen */
 
+  // Per display row, the span of columns that may differ from what is on
+  // the real screen. Rows with left >= right don't need painting.
+  struct { short left, right; } *dirty;
+  bool all_dirty;  // Every row needs painting, whatever dirty says
+
+  // View state as of the last term_paint(), for working out what to repaint
+  // when it changes.
+  struct {
+    int disptop;
+    int curs_y;  // Screen line the cursor was on, or -1 if it was hidden
+    bool selected, sel_rect;
+    pos sel_start, sel_end;
+    bool show_other_screen, in_vbell, has_focus, tblinker;
+  } painted;
+
   termchar erase_char;
 
   char *inbuf;      /* terminal input buffer */
@@ -292,10 +380,11 @@ struct term {
 
   uchar *tabs;
 
+  // Parser state. Transitions are in parse_table, see tools/mkparsetab.c.
   enum {
-    NORMAL, ESCAPE, CSI_ARGS,
-    IGNORE_STRING, CMD_STRING, CMD_ESCAPE,
-    OSC_START, OSC_NUM, OSC_PALETTE
+    NORMAL, ESCAPE, ESC_INTERMEDIATE, CSI_ARGS,
+    OSC_START, OSC_NUM, OSC_PALETTE, CMD_STRING, CMD_ESCAPE,
+    DCS_STRING, IGNORE_STRING, SOS_STRING
   } state;
 
   // Mouse mode
@@ -340,8 +429,6 @@ struct term {
  /*
   * These are buffers used by the bidi and Arabic shaping code.
   */
-  termchar *ltemp;
-  int ltemp_size;
   bidi_char *wcFrom, *wcTo;
   int wcFromTo_size;
   bidi_cache_entry *pre_bidi_cache, *post_bidi_cache;
@@ -359,11 +446,21 @@ void term_mouse_release(mouse_button, mod_keys, pos);
 void term_mouse_move(mod_keys, pos);
 void term_mouse_wheel(int delta, int lines_per_notch, mod_keys, pos);
 void term_select_all(void);
+bool term_search(const wchar *, int len, bool match_case, bool backward,
+                 pos *start, pos *end);
+typedef struct {
+  pos start, end;
+} search_match;
+int term_search_regex_start(string, bool match_case);
+bool term_search_regex_done(void);
+int term_search_regex_finish(search_match **);
 void term_paint(void);
 void term_invalidate(int left, int top, int right, int bottom);
 void term_open(void);
 void term_copy(void);
 void term_paste(wchar *, uint len);
+typedef enum { EXPORT_TEXT, EXPORT_SGR, EXPORT_HTML } export_format;
+bool term_export(int fd, export_format);
 void term_send_paste(void);
 void term_cancel_paste(void);
 void term_reconfig(void);
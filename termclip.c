@@ -8,6 +8,7 @@
 #include "win.h"
 #include "child.h"
 #include "charset.h"
+#include "appinfo.h"
 
 /*
  * Helper routine for term_copy(): growing buffer.
@@ -71,8 +72,8 @@ get_selection(clip_workbuf *buf)
     * newline at the end)...
     */
     if (!(line->attr & LATTR_WRAPPED)) {
-      while (nlpos.x && line->chars[nlpos.x - 1].chr == ' ' &&
-             !line->chars[nlpos.x - 1].cc_next && poslt(start, nlpos))
+      while (nlpos.x && cell_chr(line, nlpos.x - 1) == ' ' &&
+             !cell_cc(line, nlpos.x - 1) && poslt(start, nlpos))
         decpos(nlpos);
       if (poslt(nlpos, end))
         nl = true;
@@ -99,22 +100,22 @@ get_selection(clip_workbuf *buf)
       wchar cbuf[16], *p;
       int x = start.x;
 
-      if (line->chars[x].chr == UCSWIDE) {
+      if (cell_chr(line, x) == UCSWIDE) {
         start.x++;
         continue;
       }
 
       while (1) {
-        wchar c = line->chars[x].chr;
-        attr = line->chars[x].attr;
+        wchar c = cell_chr(line, x);
+        attr = cell_attr(line, x);
         cbuf[0] = c;
         cbuf[1] = 0;
 
         for (p = cbuf; *p; p++)
           clip_addchar(buf, *p, attr);
 
-        if (line->chars[x].cc_next)
-          x += line->chars[x].cc_next;
+        if (cell_cc(line, x))
+          x += cell_cc(line, x);
         else
           break;
       }
@@ -215,9 +216,256 @@ term_send_paste(void)
 void
 term_select_all(void)
 {
+  scrollback_reflow(term.sblines, term.cols);
   term.sel_start = (pos){-sblines(), 0};
   term.sel_end = (pos){term_last_nonempty_line(), term.cols};
   term.selected = true;
   if (cfg.copy_on_select)
     term_copy();
 }
+
+/*
+ * Exporting the scrollback and screen to a file. Unlike copying, this
+ * doesn't collect everything in memory first: lines are decoded one at a
+ * time into a reused termline, bypassing the scrollback cache, and output
+ * goes through a fixed-size buffer. Lines are joined and trimmed as in
+ * get_selection(). Text is written in the terminal's character set, while
+ * HTML uses character references for anything beyond ASCII.
+ */
+
+typedef struct {
+  int fd;
+  bool failed;
+  int len;
+  char data[0x10000];
+} export_buf;
+
+static void
+export_flush(export_buf *b)
+{
+  for (char *p = b->data; !b->failed && p < b->data + b->len;) {
+    int n = write(b->fd, p, b->data + b->len - p);
+    if (n > 0)
+      p += n;
+    else if (n < 0 && errno != EINTR)
+      b->failed = true;
+  }
+  b->len = 0;
+}
+
+static void
+export_write(export_buf *b, const char *s, int len)
+{
+  if (b->len + len > (int)sizeof b->data)
+    export_flush(b);
+  memcpy(b->data + b->len, s, len);
+  b->len += len;
+}
+
+static void __attribute__((format(printf, 2, 3)))
+export_printf(export_buf *b, const char *fmt, ...)
+{
+  char s[256];
+  va_list va;
+  va_start(va, fmt);
+  int len = vsnprintf(s, sizeof s, fmt, va);
+  va_end(va);
+  export_write(b, s, min(len, (int)sizeof s - 1));
+}
+
+enum {
+  EXPORT_ATTRS = ATTR_FGMASK | ATTR_BGMASK | ATTR_BOLD | ATTR_DIM |
+                 ATTR_UNDER | ATTR_BLINK | ATTR_REVERSE | ATTR_INVISIBLE
+};
+
+static void
+export_sgr(export_buf *b, uint attr)
+{
+  export_write(b, "\e[0", 3);
+  if (attr & ATTR_BOLD)
+    export_write(b, ";1", 2);
+  if (attr & ATTR_DIM)
+    export_write(b, ";2", 2);
+  if (attr & ATTR_UNDER)
+    export_write(b, ";4", 2);
+  if (attr & ATTR_BLINK)
+    export_write(b, ";5", 2);
+  if (attr & ATTR_REVERSE)
+    export_write(b, ";7", 2);
+  if (attr & ATTR_INVISIBLE)
+    export_write(b, ";8", 2);
+  uint fg = (attr & ATTR_FGMASK) >> ATTR_FGSHIFT;
+  if (fg < 16)
+    export_printf(b, ";%u", (fg < 8 ? 30 : 90) + (fg & 7));
+  else if (fg < 256)
+    export_printf(b, ";38;5;%u", fg);
+  uint bg = (attr & ATTR_BGMASK) >> ATTR_BGSHIFT;
+  if (bg < 16)
+    export_printf(b, ";%u", (bg < 8 ? 40 : 100) + (bg & 7));
+  else if (bg < 256)
+    export_printf(b, ";48;5;%u", bg);
+  export_write(b, "m", 1);
+}
+
+static void
+export_colour(export_buf *b, string prop, colour c)
+{
+  export_printf(b, "%s:#%02x%02x%02x;", prop, red(c), green(c), blue(c));
+}
+
+static void
+export_span(export_buf *b, uint attr)
+{
+  colour_i fgi = (attr & ATTR_FGMASK) >> ATTR_FGSHIFT;
+  colour_i bgi = (attr & ATTR_BGMASK) >> ATTR_BGSHIFT;
+  if (attr & ATTR_REVERSE) {
+    colour_i t = fgi;
+    fgi = bgi;
+    bgi = t;
+  }
+  if (attr & ATTR_INVISIBLE)
+    fgi = bgi;
+  export_write(b, "<span style=\"", 13);
+  if (fgi != FG_COLOUR_I)
+    export_colour(b, "color", win_get_colour(fgi));
+  if (bgi != BG_COLOUR_I)
+    export_colour(b, "background-color", win_get_colour(bgi));
+  if (attr & ATTR_BOLD)
+    export_printf(b, "font-weight:bold;");
+  if (attr & ATTR_DIM)
+    export_printf(b, "opacity:0.7;");
+  if (attr & (ATTR_UNDER | ATTR_BLINK))
+    export_printf(b, "text-decoration:%s;",
+                  attr & ATTR_UNDER ? "underline" : "blink");
+  export_write(b, "\">", 2);
+}
+
+/* Write the characters in a cell, including combining characters. */
+static void
+export_chars(export_buf *b, export_format fmt, termline *line, int x)
+{
+  wchar wcs[16];
+  int n = 0;
+  for (;;) {
+    if (n < (int)lengthof(wcs))
+      wcs[n++] = cell_chr(line, x) ?: ' ';
+    if (!cell_cc(line, x))
+      break;
+    x += cell_cc(line, x);
+  }
+  if (fmt != EXPORT_HTML) {
+    char s[lengthof(wcs) * 8];
+    export_write(b, s, cs_wcntombn(s, wcs, sizeof s, n));
+    return;
+  }
+  for (int i = 0; i < n; i++) {
+    xchar xc = wcs[i];
+    if (is_high_surrogate(xc) && i + 1 < n && is_low_surrogate(wcs[i + 1]))
+      xc = combine_surrogates(xc, wcs[++i]);
+    switch (xc) {
+      when '<': export_write(b, "&lt;", 4);
+      when '>': export_write(b, "&gt;", 4);
+      when '&': export_write(b, "&amp;", 5);
+      otherwise:
+        if (xc < 0x80)
+          export_write(b, (char[]){xc}, 1);
+        else
+          export_printf(b, "&#x%X;", xc);
+    }
+  }
+}
+
+/*
+ * Write the scrollback and screen contents to a file descriptor, as plain
+ * text, as text with SGR escape sequences, or as an HTML document. Returns
+ * false if writing failed, with errno set.
+ */
+bool
+term_export(int fd, export_format fmt)
+{
+  scrollback_reflow(term.sblines, term.cols);
+
+  export_buf *b = new(export_buf);
+  b->fd = fd;
+  b->failed = false;
+  b->len = 0;
+
+  if (fmt == EXPORT_HTML) {
+    export_printf(b,
+      "<!DOCTYPE html>\n"
+      "<html>\n<head>\n<meta charset=\"us-ascii\">\n"
+      "<title>%s</title>\n</head>\n<body>\n<pre style=\"", APPNAME);
+    export_colour(b, "color", win_get_colour(FG_COLOUR_I));
+    export_colour(b, "background-color", win_get_colour(BG_COLOUR_I));
+    export_write(b, "\">", 2);
+  }
+
+  // Lines are read from storage directly rather than through fetch_line().
+  scrollback_flush();
+  termline *sbline = newline(term.cols, false);
+
+  int sbend = term.sbfirst + term.sblines;
+  int last = term_last_nonempty_line();
+  uint attr = ATTR_DEFAULT;
+  for (int y = -sblines(); y <= last && !b->failed; y++) {
+    termline *line;
+    if (y < 0) {
+      line = sbline;
+      decompressline_into(scrollback_line(sbend + y), line);
+      resizeline(line, term.cols);
+    }
+    else
+      line = fetch_line(y);
+
+    int end = term.cols;
+    bool nl = false;
+    if (!(line->attr & LATTR_WRAPPED)) {
+      while (end && cell_chr(line, end - 1) == ' ' &&
+             !cell_cc(line, end - 1))
+        end--;
+      nl = y < last || end < term.cols;
+    }
+    else if (line->attr & LATTR_WRAPPED2) {
+     /* Ignore the last char on the line in a WRAPPED2 line. */
+      end--;
+    }
+
+    for (int x = 0; x < end; x++) {
+      if (cell_chr(line, x) == UCSWIDE)
+        continue;
+      uint a = cell_attr(line, x) & EXPORT_ATTRS;
+      if (a != attr && fmt != EXPORT_TEXT) {
+        if (fmt == EXPORT_SGR)
+          export_sgr(b, a);
+        else {
+          if (attr != ATTR_DEFAULT)
+            export_write(b, "</span>", 7);
+          if (a != ATTR_DEFAULT)
+            export_span(b, a);
+        }
+        attr = a;
+      }
+      export_chars(b, fmt, line, x);
+    }
+    if (nl) {
+      // Don't let attributes carry over into the next line.
+      if (attr != ATTR_DEFAULT) {
+        export_write(b, fmt == EXPORT_SGR ? "\e[0m" : "</span>",
+                     fmt == EXPORT_SGR ? 4 : 7);
+        attr = ATTR_DEFAULT;
+      }
+      export_write(b, "\n", 1);
+    }
+  }
+  if (attr != ATTR_DEFAULT)
+    export_write(b, fmt == EXPORT_SGR ? "\e[0m" : "</span>",
+                 fmt == EXPORT_SGR ? 4 : 7);
+  if (fmt == EXPORT_HTML)
+    export_printf(b, "</pre>\n</body>\n</html>\n");
+
+  freeline(sbline);
+  export_flush(b);
+  bool ok = !b->failed;
+  free(b);
+  return ok;
+}
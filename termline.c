@@ -5,16 +5,212 @@
 
 #include "termpriv.h"
 
+#ifdef CELL_ARRAYS
+enum { CELL_SIZE = sizeof(uint) + sizeof(wchar) + sizeof(short) };
+#else
+enum { CELL_SIZE = sizeof(termchar) };
+#endif
+
+/* The allocation holding a line's cells. */
+static char *
+line_cells(termline *line)
+{
+#ifdef CELL_ARRAYS
+  return (char *)line->attrs;
+#else
+  return (char *)line->chars;
+#endif
+}
+
+/* Point a line at an allocation of line->size cells. */
+static void
+set_cells(termline *line, char *cells)
+{
+#ifdef CELL_ARRAYS
+  line->attrs = (uint *)cells;
+  line->chrs = (wchar *)(line->attrs + line->size);
+  line->ccs = (short *)(line->chrs + line->size);
+#else
+  line->chars = (termchar *)cells;
+#endif
+}
+
+/*
+ * Change the number of cells allocated for a line, keeping the contents
+ * of those that remain.
+ */
+static void
+resize_cells(termline *line, int size)
+{
+  char *cells = line_cells(line);
+#ifdef CELL_ARRAYS
+ /*
+  * The character and cc_next arrays start at offsets that depend on the
+  * size, so they have to be moved: up after growing the allocation, or
+  * down before shrinking it.
+  */
+  int old = line->size, keep = min(old, size);
+  if (size > old)
+    cells = renewn(cells, size * CELL_SIZE);
+  char *old_chrs = cells + old * sizeof(uint);
+  char *old_ccs = old_chrs + old * sizeof(wchar);
+  char *new_chrs = cells + size * sizeof(uint);
+  char *new_ccs = new_chrs + size * sizeof(wchar);
+  if (size > old) {
+    memmove(new_ccs, old_ccs, keep * sizeof(short));
+    memmove(new_chrs, old_chrs, keep * sizeof(wchar));
+  }
+  else {
+    memmove(new_chrs, old_chrs, keep * sizeof(wchar));
+    memmove(new_ccs, old_ccs, keep * sizeof(short));
+    cells = renewn(cells, size * CELL_SIZE);
+  }
+#else
+  cells = renewn(cells, size * CELL_SIZE);
+#endif
+  line->size = size;
+  set_cells(line, cells);
+}
+
+/* Move n cells within a line, as memmove() would. */
+static void
+move_cells(termline *line, int dest, int src, int n)
+{
+#ifdef CELL_ARRAYS
+  memmove(line->attrs + dest, line->attrs + src, n * sizeof(uint));
+  memmove(line->chrs + dest, line->chrs + src, n * sizeof(wchar));
+  memmove(line->ccs + dest, line->ccs + src, n * sizeof(short));
+#else
+  memmove(line->chars + dest, line->chars + src, n * sizeof(termchar));
+#endif
+}
+
+/*
+ * Scrolling, fetching scrollback lines and rewrapping make and free lines
+ * all the time, so rather than going back to malloc, freed lines are kept
+ * for reuse: line structures in one list, and cell arrays in lists for
+ * the few most recently used lengths. Only arrays without room for
+ * combining characters are kept, so their lengths are column counts.
+ * The pools are per thread, as search workers make lines too, and they
+ * are capped so that idle terminals don't hold on to much memory.
+ */
+enum { POOL_LENGTHS = 4, POOL_LINES = 256, POOL_BYTES = 64 * 1024 };
+
+typedef struct pool_entry { struct pool_entry *next; } pool_entry;
+
+static __thread struct {
+  pool_entry *lines;
+  int line_count;
+  struct {
+    int len, count;
+    pool_entry *free;
+  } cells[POOL_LENGTHS];
+  int evict;
+  size_t bytes;
+  poolstats stats;
+} pool;
+
+static termline *
+alloc_line(void)
+{
+  pool_entry *e = pool.lines;
+  if (!e) {
+    pool.stats.line_misses++;
+    return new(termline);
+  }
+  pool.stats.line_hits++;
+  pool.lines = e->next;
+  pool.line_count--;
+  return (termline *)e;
+}
+
+static void
+free_line(termline *line)
+{
+  if (pool.line_count == POOL_LINES) {
+    free(line);
+    return;
+  }
+  pool_entry *e = (pool_entry *)line;
+  e->next = pool.lines;
+  pool.lines = e;
+  pool.line_count++;
+}
+
+/* Get room for len cells, with undefined contents. */
+static char *
+alloc_cells(int len)
+{
+  for (int i = 0; i < POOL_LENGTHS; i++) {
+    if (pool.cells[i].len == len && pool.cells[i].free) {
+      pool_entry *e = pool.cells[i].free;
+      pool.cells[i].free = e->next;
+      pool.cells[i].count--;
+      pool.bytes -= len * CELL_SIZE;
+      pool.stats.cells_hits++;
+      return (char *)e;
+    }
+  }
+  pool.stats.cells_misses++;
+  return newn(char, len * CELL_SIZE);
+}
+
+static void
+free_cells(char *cells, int len)
+{
+  size_t bytes = len * CELL_SIZE;
+  if (pool.bytes + bytes > POOL_BYTES) {
+    free(cells);
+    return;
+  }
+
+  // Find the list for this length, or else an empty one, or else make
+  // room by emptying one in turn.
+  int i = 0;
+  while (i < POOL_LENGTHS && pool.cells[i].len != len)
+    i++;
+  if (i == POOL_LENGTHS) {
+    i = 0;
+    while (i < POOL_LENGTHS && pool.cells[i].count)
+      i++;
+  }
+  if (i == POOL_LENGTHS) {
+    i = pool.evict++ % POOL_LENGTHS;
+    for (pool_entry *e = pool.cells[i].free, *next; e; e = next) {
+      next = e->next;
+      free(e);
+    }
+    pool.bytes -= pool.cells[i].count * pool.cells[i].len * CELL_SIZE;
+    pool.cells[i].free = 0;
+    pool.cells[i].count = 0;
+  }
+
+  pool_entry *e = (pool_entry *)cells;
+  e->next = pool.cells[i].free;
+  pool.cells[i].free = e;
+  pool.cells[i].len = len;
+  pool.cells[i].count++;
+  pool.bytes += bytes;
+}
+
+void
+line_pool_stats(poolstats *stats)
+{
+  *stats = pool.stats;
+}
+
 termline *
 newline(int cols, int bce)
 {
-  termline *line = new(termline);
-  line->chars = newn(termchar, cols);
-  for (int j = 0; j < cols; j++)
-    line->chars[j] = (bce ? term.erase_char : basic_erase_char);
+  termline *line = alloc_line();
   line->cols = line->size = cols;
+  set_cells(line, alloc_cells(cols));
+  for (int j = 0; j < cols; j++)
+    set_termchar(line, j, bce ? term.erase_char : basic_erase_char);
   line->attr = LATTR_NORM;
   line->temporary = false;
+  line->cleared = false;
+  line->shared = false;
   line->cc_free = 0;
   return line;
 }
@@ -23,8 +219,26 @@ void
 freeline(termline *line)
 {
   assert(line);
-  free(line->chars);
-  free(line);
+  if (line->shared)
+    return;  /* owned by blank_line() */
+  if (line->size == line->cols)
+    free_cells(line_cells(line), line->cols);
+  else
+    free(line_cells(line));
+  free_line(line);
+}
+
+/* Make a temporary copy of a line. */
+termline *
+copyline(termline *line)
+{
+  termline *copy = alloc_line();
+  *copy = *line;
+  set_cells(copy, alloc_cells(line->size));
+  memcpy(line_cells(copy), line_cells(line), line->size * CELL_SIZE);
+  copy->temporary = true;
+  copy->shared = false;
+  return copy;
 }
 
 /*
@@ -71,33 +285,32 @@ add_cc(termline *line, int col, wchar chr)
   */
   if (!line->cc_free) {
     int n = line->size;
-    line->size += 16 + (line->size - line->cols) / 2;
-    line->chars = renewn(line->chars, line->size);
+    resize_cells(line, n + 16 + (n - line->cols) / 2);
     line->cc_free = n;
     do
-      line->chars[n].cc_next = 1;
+      cell_cc(line, n) = 1;
     while (++n < line->size - 1);
-    line->chars[n].cc_next = 0;  // Terminates the free list.
+    cell_cc(line, n) = 0;  // Terminates the free list.
   }
 
  /*
   * Now walk the cc list of the cell in question.
   */
-  while (line->chars[col].cc_next)
-    col += line->chars[col].cc_next;
+  while (cell_cc(line, col))
+    col += cell_cc(line, col);
 
  /*
   * `col' now points at the last cc currently in this cell; so
   * we simply add another one.
   */
   int newcc = line->cc_free;
-  if (line->chars[newcc].cc_next)
-    line->cc_free = newcc + line->chars[newcc].cc_next;
+  if (cell_cc(line, newcc))
+    line->cc_free = newcc + cell_cc(line, newcc);
   else
     line->cc_free = 0;
-  line->chars[newcc].cc_next = 0;
-  line->chars[newcc].chr = chr;
-  line->chars[col].cc_next = newcc - col;
+  cell_cc(line, newcc) = 0;
+  cell_chr(line, newcc) = chr;
+  cell_cc(line, col) = newcc - col;
 }
 
 /*
@@ -110,19 +323,19 @@ clear_cc(termline *line, int col)
 
   assert(col >= 0 && col < line->cols);
 
-  if (!line->chars[col].cc_next)
+  if (!cell_cc(line, col))
     return;     /* nothing needs doing */
 
   oldfree = line->cc_free;
-  line->cc_free = col + line->chars[col].cc_next;
-  while (line->chars[col].cc_next)
-    col += line->chars[col].cc_next;
+  line->cc_free = col + cell_cc(line, col);
+  while (cell_cc(line, col))
+    col += cell_cc(line, col);
   if (oldfree)
-    line->chars[col].cc_next = oldfree - col;
+    cell_cc(line, col) = oldfree - col;
   else
-    line->chars[col].cc_next = 0;
+    cell_cc(line, col) = 0;
 
-  line->chars[origcol].cc_next = 0;
+  cell_cc(line, origcol) = 0;
 }
 
 /*
@@ -130,29 +343,41 @@ clear_cc(termline *line, int col)
  * in do_paint() where we override what we expect the chr and attr
  * fields to be.
  */
-int
-termchars_equal_override(termchar *a, termchar *b, uint bchr, uint battr)
+bool
+termchars_equal_override(termline *a, int ax, termline *b, int bx,
+                         uint bchr, uint battr)
 {
  /* FULL-TERMCHAR */
-  if (a->chr != bchr)
+  if (cell_chr(a, ax) != bchr)
     return false;
-  if ((a->attr & ~DATTR_MASK) != (battr & ~DATTR_MASK))
+  if ((cell_attr(a, ax) & ~DATTR_MASK) != (battr & ~DATTR_MASK))
     return false;
-  while (a->cc_next || b->cc_next) {
-    if (!a->cc_next || !b->cc_next)
+  while (cell_cc(a, ax) || cell_cc(b, bx)) {
+    if (!cell_cc(a, ax) || !cell_cc(b, bx))
       return false;     /* one cc-list ends, other does not */
-    a += a->cc_next;
-    b += b->cc_next;
-    if (a->chr != b->chr)
+    ax += cell_cc(a, ax);
+    bx += cell_cc(b, bx);
+    if (cell_chr(a, ax) != cell_chr(b, bx))
       return false;
   }
   return true;
 }
 
-int
-termchars_equal(termchar *a, termchar *b)
+bool
+termchars_equal(termline *a, int ax, termline *b, int bx)
 {
-  return termchars_equal_override(a, b, b->chr, b->attr);
+  return
+    termchars_equal_override(a, ax, b, bx, cell_chr(b, bx), cell_attr(b, bx));
+}
+
+/* Compare a cell with a termchar that has no combining characters. */
+bool
+termchar_is(termline *line, int x, termchar *c)
+{
+ /* FULL-TERMCHAR */
+  return
+    cell_chr(line, x) == c->chr && cell_attr(line, x) == c->attr &&
+    !cell_cc(line, x);
 }
 
 /*
@@ -160,16 +385,17 @@ termchars_equal(termchar *a, termchar *b)
  * termline, so as to access its free list.)
  */
 void
-copy_termchar(termline *destline, int x, termchar *src)
+copy_termchar(termline *destline, int x, termline *srcline, int srcx)
 {
   clear_cc(destline, x);
 
-  destline->chars[x] = *src;    /* copy everything except cc-list */
-  destline->chars[x].cc_next = 0;       /* and make sure this is zero */
+  cell_chr(destline, x) = cell_chr(srcline, srcx);
+  cell_attr(destline, x) = cell_attr(srcline, srcx);
+  cell_cc(destline, x) = 0;     /* cc-list is copied below */
 
-  while (src->cc_next) {
-    src += src->cc_next;
-    add_cc(destline, x, src->chr);
+  while (cell_cc(srcline, srcx)) {
+    srcx += cell_cc(srcline, srcx);
+    add_cc(destline, x, cell_chr(srcline, srcx));
   }
 }
 
@@ -177,22 +403,23 @@ copy_termchar(termline *destline, int x, termchar *src)
  * Move a character cell within its termline.
  */
 void
-move_termchar(termline * line, termchar *dest, termchar *src)
+move_termchar(termline *line, int dest, int src)
 {
  /* First clear the cc list from the original char, just in case. */
-  clear_cc(line, dest - line->chars);
+  clear_cc(line, dest);
 
  /* Move the character cell and adjust its cc_next. */
-  *dest = *src; /* copy everything except cc-list */
-  if (src->cc_next)
-    dest->cc_next = src->cc_next - (dest - src);
+  termchar c = get_termchar(line, src);
+  if (c.cc_next)
+    c.cc_next -= dest - src;
+  set_termchar(line, dest, c);
 
  /* Ensure the original cell doesn't have a cc list. */
-  src->cc_next = 0;
+  cell_cc(line, src) = 0;
 }
 
 static void
-makeliteral_chr(struct buf *buf, termchar *c)
+makeliteral_wchar(struct buf *buf, wchar wc)
 {
  /*
   * The encoding for characters assigns one-byte codes to printable
@@ -200,7 +427,6 @@ makeliteral_chr(struct buf *buf, termchar *c)
   * to 0x96FF. UTF-16 surrogates also get two-byte codes, to avoid non-BMP
   * characters exploding to six bytes. Anything else is three bytes long.
   */
-  wchar wc = c->chr;
   if (wc == 0 || (wc >= 0x20 && wc < 0x7F))
     ;
   else {
@@ -219,7 +445,13 @@ makeliteral_chr(struct buf *buf, termchar *c)
 }
 
 static void
-makeliteral_attr(struct buf *b, termchar *c)
+makeliteral_chr(struct buf *buf, termline *line, int x)
+{
+  makeliteral_wchar(buf, cell_chr(line, x));
+}
+
+static void
+makeliteral_attr(struct buf *b, termline *line, int x)
 {
  /*
   * My encoding for attributes is 16-bit-granular and assumes
@@ -237,7 +469,7 @@ makeliteral_attr(struct buf *b, termchar *c)
   */
   uint attr, colourbits;
 
-  attr = c->attr;
+  attr = cell_attr(line, x);
 
   assert(ATTR_BGSHIFT > ATTR_FGSHIFT);
 
@@ -267,7 +499,7 @@ makeliteral_attr(struct buf *b, termchar *c)
 }
 
 static void
-makeliteral_cc(struct buf *b, termchar *c)
+makeliteral_cc(struct buf *b, termline *line, int x)
 {
  /*
   * For combining characters, I just encode a bunch of ordinary
@@ -275,24 +507,21 @@ makeliteral_cc(struct buf *b, termchar *c)
   * character (which I know won't come up as a combining char
   * itself).
   */
-  termchar z;
-
-  while (c->cc_next) {
-    c += c->cc_next;
-    assert(c->chr != 0);
-    makeliteral_chr(b, c);
+  while (cell_cc(line, x)) {
+    x += cell_cc(line, x);
+    assert(cell_chr(line, x) != 0);
+    makeliteral_chr(b, line, x);
   }
 
-  z.chr = 0;
-  makeliteral_chr(b, &z);
+  makeliteral_wchar(b, 0);
 }
 
-static void
-readliteral_chr(struct buf *buf, termchar *c, termline *unused(line))
+static wchar
+readliteral_wchar(struct buf *buf)
 {
   uchar b = get(buf);
   if (b == 0 || (b >= 0x20 && b < 0x7F))
-    c->chr = b;
+    return b;
   else {
     if (b >= 0x80)
       b -= 0x80;
@@ -302,12 +531,18 @@ readliteral_chr(struct buf *buf, termchar *c, termline *unused(line))
       b += 0xC0;
     else
       b = get(buf);
-    c->chr = b << 8 | get(buf);
+    return b << 8 | get(buf);
   }
 }
 
 static void
-readliteral_attr(struct buf *b, termchar *c, termline *unused(line))
+readliteral_chr(struct buf *buf, termline *line, int x)
+{
+  cell_chr(line, x) = readliteral_wchar(buf);
+}
+
+static void
+readliteral_attr(struct buf *b, termline *line, int x)
 {
   uint val, attr, colourbits;
 
@@ -334,31 +569,28 @@ readliteral_attr(struct buf *b, termchar *c, termline *unused(line))
   attr |= (colourbits >> 4) << (ATTR_BGSHIFT + 4);
   attr |= (colourbits & 0xF) << (ATTR_FGSHIFT + 4);
 
-  c->attr = attr;
+  cell_attr(line, x) = attr;
 }
 
 static void
-readliteral_cc(struct buf *b, termchar *c, termline *line)
+readliteral_cc(struct buf *b, termline *line, int x)
 {
-  termchar n;
-  int x = c - line->chars;
-
-  c->cc_next = 0;
+  cell_cc(line, x) = 0;
 
   while (1) {
-    readliteral_chr(b, &n, line);
-    if (!n.chr)
+    wchar wc = readliteral_wchar(b);
+    if (!wc)
       break;
-    add_cc(line, x, n.chr);
+    add_cc(line, x, wc);
   }
 }
 
 static void
 makerle(struct buf *b, termline *line,
-        void (*makeliteral) (struct buf *b, termchar *c))
+        void (*makeliteral) (struct buf *b, termline *line, int x))
 {
   int hdrpos, hdrsize, n, prevlen, prevpos, thislen, thispos, prev2;
-  termchar *c = line->chars;
+  int x = 0;
 
   n = line->cols;
 
@@ -370,7 +602,7 @@ makerle(struct buf *b, termline *line,
 
   while (n-- > 0) {
     thispos = b->len;
-    makeliteral(b, c++);
+    makeliteral(b, line, x++);
     thislen = b->len - thispos;
     if (thislen == prevlen &&
         !memcmp(b->data + prevpos, b->data + thispos, thislen)) {
@@ -423,14 +655,14 @@ makerle(struct buf *b, termline *line,
         while (n > 0 && runlen < 129) {
           int tmppos, tmplen;
           tmppos = b->len;
-          makeliteral(b, c);
+          makeliteral(b, line, x);
           tmplen = b->len - tmppos;
           b->len = tmppos;
           if (tmplen != thislen ||
               memcmp(b->data + runpos + 1, b->data + tmppos, tmplen)) {
             break;      /* run over */
           }
-          n--, c++, runlen++;
+          n--, x++, runlen++;
         }
 
         assert(runlen >= 2 && runlen <= 129);
@@ -488,10 +720,29 @@ makerle(struct buf *b, termline *line,
 }
 
 
-uchar *
-compressline(termline *line)
+/*
+ * Compress a line into the buffer at *data_p, which has *size_p bytes
+ * allocated and is grown as necessary. Returns the compressed length.
+ */
+int
+compressline(termline *line, uchar **data_p, int *size_p)
 {
-  struct buf buffer = { null, 0, 0 }, *b = &buffer;
+  if (line->cleared) {
+   /* Compress the uniform cells of a cleared line without filling it in. */
+    termchar cells[line->cols];  /* at least CELL_SIZE each */
+    termline filled = *line;
+    filled.size = filled.cols;
+    set_cells(&filled, (char *)cells);
+    filled.cleared = false;
+    filled.cc_free = 0;
+    termchar erase_char = basic_erase_char;
+    erase_char.attr = line->erase_attr;
+    for (int j = 0; j < line->cols; j++)
+      set_termchar(&filled, j, erase_char);
+    return compressline(&filled, data_p, size_p);
+  }
+
+  struct buf buffer = { *data_p, 0, *size_p }, *b = &buffer;
 
  /*
   * First, store the column count, 7 bits at a time, least
@@ -536,15 +787,14 @@ compressline(termline *line)
   makerle(b, line, makeliteral_attr);
   makerle(b, line, makeliteral_cc);
 
- /*
-  * Trim the allocated memory so we don't waste any, and return.
-  */
-  return renewn(b->data, b->len);
+  *data_p = b->data;
+  *size_p = b->size;
+  return b->len;
 }
 
 static void
 readrle(struct buf *b, termline *line,
-        void (*readliteral) (struct buf *b, termchar *c, termline *line))
+        void (*readliteral) (struct buf *b, termline *line, int x))
 {
   int n = 0;
 
@@ -558,7 +808,7 @@ readrle(struct buf *b, termline *line,
       while (count--) {
         assert(n < line->cols);
         b->len = pos;
-        readliteral(b, line->chars + n, line);
+        readliteral(b, line, n);
         n++;
       }
     }
@@ -568,7 +818,7 @@ readrle(struct buf *b, termline *line,
       int count = hdr + 1;
       while (count--) {
         assert(n < line->cols);
-        readliteral(b, line->chars + n, line);
+        readliteral(b, line, n);
         n++;
       }
     }
@@ -577,12 +827,11 @@ readrle(struct buf *b, termline *line,
   assert(n == line->cols);
 }
 
-termline *
-decompressline(uchar *data, int *bytes_used)
+static termline *
+decompress(uchar *data, termline *line, int *bytes_used)
 {
   int ncols, byte, shift;
   struct buf buffer, *b = &buffer;
-  termline *line;
 
   b->data = data;
   b->len = 0;
@@ -598,16 +847,23 @@ decompressline(uchar *data, int *bytes_used)
   } while (byte & 0x80);
 
  /*
-  * Now create the output termline.
+  * Now create the output termline, or make room in the given one.
   */
-  line = new(termline);
-  line->chars = newn(termchar, ncols);
-  line->cols = line->size = ncols;
-  line->temporary = true;
+  if (!line) {
+    line = alloc_line();
+    line->size = ncols;
+    set_cells(line, alloc_cells(ncols));
+    line->temporary = true;
+  }
+  else if (line->size != ncols)
+    resize_cells(line, ncols);
+  line->cols = ncols;
   line->cc_free = 0;
+  line->cleared = false;
+  line->shared = false;
 
  /*
-  * We must set all the cc pointers in line->chars to 0 right
+  * We must set all the cc pointers in the line to 0 right
   * now, so that cc diagnostics that verify the integrity of the
   * whole line will make sense while we're in the middle of
   * building it up.
@@ -615,7 +871,7 @@ decompressline(uchar *data, int *bytes_used)
   {
     int i;
     for (i = 0; i < line->cols; i++)
-      line->chars[i].cc_next = 0;
+      cell_cc(line, i) = 0;
   }
 
  /*
@@ -642,20 +898,137 @@ decompressline(uchar *data, int *bytes_used)
   return line;
 }
 
+termline *
+decompressline(uchar *data, int *bytes_used)
+{
+  return decompress(data, 0, bytes_used);
+}
+
+/*
+ * Get the line attributes of a compressed line without decompressing it.
+ */
+int
+decompressline_attr(uchar *data)
+{
+  int i = 0;
+  while (data[i++] & 0x80);
+
+  int attr = 0, shift = 0;
+  uchar byte;
+  do {
+    byte = data[i++];
+    attr |= (byte & 0x7F) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  return attr;
+}
+
 /*
- * Clear a line, throwing away any combining characters.
+ * Decompress a line into an existing one, reusing its storage, which saves
+ * allocations where many lines are decoded in turn.
  */
 void
+decompressline_into(uchar *data, termline *line)
+{
+  decompress(data, line, 0);
+}
+
+/*
+ * Clear a line, throwing away any combining characters. Returns the line
+ * to use in its place, which is a different one if a shared blank line is
+ * cleared with other attributes.
+ *
+ * As lines are often cleared again before anything is written to them,
+ * for example by applications that keep clearing the screen, this only
+ * records the erase attributes. The cells are filled in by fill_cleared()
+ * when they're next needed, which term_line() and fetch_line() take care
+ * of.
+ */
+termline *
 clearline(termline *line)
 {
+  if (line->shared)
+    return blank_line(line->cols, term.erase_char.attr);
   line->attr = LATTR_NORM;
+  line->cleared = true;
+  line->erase_attr = term.erase_char.attr;
+  return line;
+}
+
+/*
+ * Fill in the cells of a cleared line. A shared blank line is left alone,
+ * and a private copy of it is returned instead.
+ */
+termline *
+fill_cleared(termline *line)
+{
+  if (line->shared) {
+    termline *copy = copyline(line);
+    copy->temporary = false;
+    copy->cleared = false;
+    return copy;
+  }
+
+  termchar erase_char = basic_erase_char;
+  erase_char.attr = line->erase_attr;
   for (int j = 0; j < line->cols; j++)
-    line->chars[j] = term.erase_char;
+    set_termchar(line, j, erase_char);
   if (line->size > line->cols) {
-    line->size = line->cols;
-    line->chars = renewn(line->chars, line->size);
+    resize_cells(line, line->cols);
     line->cc_free = 0;
   }
+  line->cleared = false;
+  return line;
+}
+
+/*
+ * Blank lines that screen rows point to until something is written to
+ * them, so that idle terminals, and the alternate screen in particular,
+ * don't need storage for every row. There's one for each width and erase
+ * attribute in use. They count as cleared, so term_line() swaps them for
+ * a private copy before they're changed.
+ */
+static termline **blank_lines;
+static int blank_count;
+
+termline *
+blank_line(int cols, uint attr)
+{
+  for (int i = 0; i < blank_count; i++) {
+    termline *line = blank_lines[i];
+    if (line->cols == cols && line->erase_attr == attr)
+      return line;
+  }
+
+  termline *line = newline(cols, false);
+  for (int j = 0; j < cols; j++)
+    cell_attr(line, j) = attr;
+  line->cleared = true;
+  line->shared = true;
+  line->erase_attr = attr;
+  blank_lines = renewn(blank_lines, blank_count + 1);
+  blank_lines[blank_count++] = line;
+  return line;
+}
+
+/*
+ * Free the blank lines of widths other than the given one, which nothing
+ * points to after a resize.
+ */
+void
+trim_blank_lines(int cols)
+{
+  int n = 0;
+  for (int i = 0; i < blank_count; i++) {
+    termline *line = blank_lines[i];
+    if (line->cols == cols)
+      blank_lines[n++] = line;
+    else {
+      free(line_cells(line));
+      free(line);
+    }
+  }
+  blank_count = n;
 }
 
 /*
@@ -666,20 +1039,21 @@ resizeline(termline *line, int cols)
 {
   int oldcols = line->cols;
 
+  assert(!line->shared);
   if (cols > oldcols) {
+    if (line->cleared)
+      fill_cleared(line);
 
    /*
     * Leave the same amount of cc space as there was to begin with.
     */
-    line->size += cols - oldcols;
-    line->chars = renewn(line->chars, line->size);
+    resize_cells(line, line->size + cols - oldcols);
     line->cols = cols;
 
    /*
     * Move the cc section.
     */
-    memmove(line->chars + cols, line->chars + oldcols,
-            (line->size - cols) * sizeof(termchar));
+    move_cells(line, cols, oldcols, line->size - cols);
 
    /*
     * Adjust the first cc_next pointer in each list. (All the
@@ -688,8 +1062,8 @@ resizeline(termline *line, int cols)
     * to the head of the cc_free list.
     */
     for (int i = 0; i < oldcols; i++)
-      if (line->chars[i].cc_next)
-        line->chars[i].cc_next += cols - oldcols;
+      if (cell_cc(line, i))
+        cell_cc(line, i) += cols - oldcols;
     if (line->cc_free)
       line->cc_free += cols - oldcols;
 
@@ -699,7 +1073,7 @@ resizeline(termline *line, int cols)
     * _know_ the erase char doesn't have one.)
     */
     for (int i = oldcols; i < cols; i++)
-      line->chars[i] = basic_erase_char;
+      set_termchar(line, i, basic_erase_char);
   }
 }
 
@@ -720,27 +1094,90 @@ sblines(void)
 termline *
 fetch_line(int y)
 {
-  termlines *lines = term.show_other_screen ? term.other_lines : term.lines;
-
   termline *line;
   if (y >= 0) {
     assert(y < term.rows);
-    line = lines[y];
+    line =
+      term.show_other_screen
+      ? term.other_lines[ring_index(term.other_lines_top, y)]
+      : term_line_slot(y);
+    if (line->cleared && !line->shared)
+      fill_cleared(line);
   }
   else {
     assert(y < term.sblines);
-    y += term.sbpos;
-    if (y < 0)
-      y += term.sblen; // Scrollback has wrapped round
-    uchar *cline = term.scrollback[y];
-    line = decompressline(cline, null);
+    int n = term.sbfirst + term.sblines + y;
+
+    sbcache_entry *lru = 0;
+    for (int i = 0; i < term.sbcache_size; i++) {
+      sbcache_entry *e = &term.sbcache[i];
+      if (e->line && e->n == n) {
+        e->used = ++term.sbcache_clock;
+        return e->line;
+      }
+      if (!lru || (lru->line && (!e->line || e->used < lru->used)))
+        lru = e;
+    }
+
+    termline *staged = scrollback_staged(n);
+    line =
+      staged ? copyline(staged) : decompressline(scrollback_line(n), null);
     resizeline(line, term.cols);
+
+    if (lru) {
+      if (lru->line)
+        freeline(lru->line);
+      line->temporary = false;  /* owned by the cache */
+      *lru = (sbcache_entry){
+        .n = n, .used = ++term.sbcache_clock, .line = line
+      };
+      if (term.sbcache_lo > term.sbcache_hi)
+        term.sbcache_lo = term.sbcache_hi = n;
+      else {
+        term.sbcache_lo = min(term.sbcache_lo, n);
+        term.sbcache_hi = max(term.sbcache_hi, n);
+      }
+    }
   }
 
   assert(line);
   return line;
 }
 
+/*
+ * Drop the cached copy of absolute scrollback line n, if any, because
+ * the line is about to go away. This happens for every line that drops
+ * off a full scrollback, so skip the search for lines that can't be in the
+ * cache.
+ */
+void
+sbcache_invalidate(int n)
+{
+  if (n < term.sbcache_lo || n > term.sbcache_hi)
+    return;
+  for (int i = 0; i < term.sbcache_size; i++) {
+    sbcache_entry *e = &term.sbcache[i];
+    if (e->line && e->n == n) {
+      freeline(e->line);
+      e->line = 0;
+    }
+  }
+}
+
+void
+sbcache_clear(void)
+{
+  for (int i = 0; i < term.sbcache_size; i++) {
+    sbcache_entry *e = &term.sbcache[i];
+    if (e->line) {
+      freeline(e->line);
+      e->line = 0;
+    }
+  }
+  term.sbcache_lo = 1;
+  term.sbcache_hi = 0;
+}
+
 /* Release a screen or scrollback line */
 void
 release_line(termline *line)
@@ -757,42 +1194,42 @@ release_line(termline *line)
  * fed to the algorithm on each line of the display.
  */
 static int
-term_bidi_cache_hit(int line, termchar *lbefore, int width)
+term_bidi_cache_hit(int scr_y, termline *line, int width)
 {
   int i;
 
   if (!term.pre_bidi_cache)
     return false;       /* cache doesn't even exist yet! */
 
-  if (line >= term.bidi_cache_size)
+  if (scr_y >= term.bidi_cache_size)
     return false;       /* cache doesn't have this many lines */
 
-  if (!term.pre_bidi_cache[line].chars)
+  termline *pre = term.pre_bidi_cache[scr_y].line;
+  if (!pre)
     return false;       /* cache doesn't contain _this_ line */
 
-  if (term.pre_bidi_cache[line].width != width)
+  if (term.pre_bidi_cache[scr_y].width != width)
     return false;       /* line is wrong width */
 
   for (i = 0; i < width; i++)
-    if (!termchars_equal(term.pre_bidi_cache[line].chars + i, lbefore + i))
+    if (!termchars_equal(pre, i, line, i))
       return false;     /* line doesn't match cache */
 
   return true;  /* it didn't match. */
 }
 
 static void
-term_bidi_cache_store(int line, termchar *lbefore, termchar *lafter,
-                      bidi_char *wcTo, int width, int size)
+term_bidi_cache_store(int scr_y, termline *line, bidi_char *wcTo, int width)
 {
   int i;
 
-  if (!term.pre_bidi_cache || term.bidi_cache_size <= line) {
+  if (!term.pre_bidi_cache || term.bidi_cache_size <= scr_y) {
     int j = term.bidi_cache_size;
-    term.bidi_cache_size = line + 1;
+    term.bidi_cache_size = scr_y + 1;
     term.pre_bidi_cache = renewn(term.pre_bidi_cache, term.bidi_cache_size);
     term.post_bidi_cache = renewn(term.post_bidi_cache, term.bidi_cache_size);
     while (j < term.bidi_cache_size) {
-      term.pre_bidi_cache[j].chars = term.post_bidi_cache[j].chars = null;
+      term.pre_bidi_cache[j].line = term.post_bidi_cache[j].line = null;
       term.pre_bidi_cache[j].width = term.post_bidi_cache[j].width = -1;
       term.pre_bidi_cache[j].forward = term.post_bidi_cache[j].forward = null;
       term.pre_bidi_cache[j].backward = term.post_bidi_cache[j].backward = null;
@@ -800,50 +1237,73 @@ term_bidi_cache_store(int line, termchar *lbefore, termchar *lafter,
     }
   }
 
-  free(term.pre_bidi_cache[line].chars);
-  free(term.post_bidi_cache[line].chars);
-  free(term.post_bidi_cache[line].forward);
-  free(term.post_bidi_cache[line].backward);
+  bidi_cache_entry *pre = &term.pre_bidi_cache[scr_y];
+  bidi_cache_entry *post = &term.post_bidi_cache[scr_y];
+
+  if (pre->line) {
+    freeline(pre->line);
+    freeline(post->line);
+  }
+  pre->line = copyline(line);
+  pre->line->temporary = false;
+  post->line = copyline(line);
+  post->line->temporary = false;
 
-  term.pre_bidi_cache[line].width = width;
-  term.pre_bidi_cache[line].chars = newn(termchar, size);
-  term.post_bidi_cache[line].width = width;
-  term.post_bidi_cache[line].chars = newn(termchar, size);
-  term.post_bidi_cache[line].forward = newn(int, width);
-  term.post_bidi_cache[line].backward = newn(int, width);
+ /*
+  * Permute the cells into display order, adjusting the cc_next offsets,
+  * which are relative, and substituting the shaped characters.
+  */
+  for (i = 0; i < width; i++) {
+    int p = wcTo[i].index;
+    termchar c = get_termchar(line, p);
+    if (c.cc_next)
+      c.cc_next -= i - p;
+    if (wcTo[i].origwc != wcTo[i].wc)
+      c.chr = wcTo[i].wc;
+    set_termchar(post->line, i, c);
+  }
+
+ /* Keep the permutation arrays of the previous entry if they fit. */
+  if (post->width != width) {
+    free(post->forward);
+    free(post->backward);
+    post->forward = newn(int, width);
+    post->backward = newn(int, width);
+  }
+  pre->width = post->width = width;
 
-  memcpy(term.pre_bidi_cache[line].chars, lbefore, size * sizeof(termchar));
-  memcpy(term.post_bidi_cache[line].chars, lafter, size * sizeof(termchar));
-  memset(term.post_bidi_cache[line].forward, 0, width * sizeof (int));
-  memset(term.post_bidi_cache[line].backward, 0, width * sizeof (int));
+  memset(post->forward, 0, width * sizeof (int));
+  memset(post->backward, 0, width * sizeof (int));
 
   for (i = 0; i < width; i++) {
     int p = wcTo[i].index;
 
     assert(0 <= p && p < width);
 
-    term.post_bidi_cache[line].backward[i] = p;
-    term.post_bidi_cache[line].forward[p] = i;
+    post->backward[i] = p;
+    post->forward[p] = i;
   }
 }
 
 /*
  * Prepare the bidi information for a screen line. Returns the
- * transformed list of termchars, or null if no transformation at
- * all took place (because bidi is disabled). If return was
- * non-null, auxiliary information such as the forward and reverse
- * mappings of permutation position are available in
- * term.post_bidi_cache[scr_y].*.
+ * transformed line, or null if no transformation at all took place
+ * (because the line doesn't contain any characters that would be
+ * affected, as flagged by LATTR_BIDI). If return was non-null,
+ * auxiliary information such as the forward and reverse mappings of
+ * permutation position are available in term.post_bidi_cache[scr_y].*.
  */
-termchar *
+termline *
 term_bidi_line(termline *line, int scr_y)
 {
-  termchar *lchars;
   int it;
 
+  if (!(line->attr & LATTR_BIDI))
+    return null;
+
  /* Do Arabic shaping and bidi. */
 
-  if (!term_bidi_cache_hit(scr_y, line->chars, term.cols)) {
+  if (!term_bidi_cache_hit(scr_y, line, term.cols)) {
 
     if (term.wcFromTo_size < term.cols) {
       term.wcFromTo_size = term.cols;
@@ -852,7 +1312,7 @@ term_bidi_line(termline *line, int scr_y)
     }
 
     for (it = 0; it < term.cols; it++) {
-      wchar c = line->chars[it].chr;
+      wchar c = cell_chr(line, it);
       term.wcFrom[it].origwc = term.wcFrom[it].wc = c;
       term.wcFrom[it].index = it;
     }
@@ -860,29 +1320,8 @@ term_bidi_line(termline *line, int scr_y)
     do_bidi(term.wcFrom, term.cols);
     do_shape(term.wcFrom, term.wcTo, term.cols);
 
-    if (term.ltemp_size < line->size) {
-      term.ltemp_size = line->size;
-      term.ltemp = renewn(term.ltemp, term.ltemp_size);
-    }
-
-    memcpy(term.ltemp, line->chars, line->size * sizeof(termchar));
-
-    for (it = 0; it < term.cols; it++) {
-      term.ltemp[it] = line->chars[term.wcTo[it].index];
-      if (term.ltemp[it].cc_next)
-        term.ltemp[it].cc_next -= it - term.wcTo[it].index;
-
-      if (term.wcTo[it].origwc != term.wcTo[it].wc)
-        term.ltemp[it].chr = term.wcTo[it].wc;
-    }
-    term_bidi_cache_store(scr_y, line->chars, term.ltemp, term.wcTo,
-                          term.cols, line->size);
-
-    lchars = term.ltemp;
-  }
-  else {
-    lchars = term.post_bidi_cache[scr_y].chars;
+    term_bidi_cache_store(scr_y, line, term.wcTo, term.cols);
   }
 
-  return lchars;
+  return term.post_bidi_cache[scr_y].line;
 }
@@ -16,9 +16,9 @@
 static wchar
 get_char(termline *line, int x)
 {
-  wchar c = line->chars[x].chr;
+  wchar c = cell_chr(line, x);
   if (c == UCSWIDE && x > 0)
-    c = line->chars[x - 1].chr;
+    c = cell_chr(line, x - 1);
   return c;
 }
 
@@ -88,13 +88,13 @@ sel_spread_half(pos p, bool forward)
       */
       termline *line = fetch_line(p.y);
       if (!(line->attr & LATTR_WRAPPED)) {
-        termchar *q = line->chars + term.cols;
-        while (q > line->chars && q[-1].chr == ' ' && !q[-1].cc_next)
+        int q = term.cols;
+        while (q > 0 && cell_chr(line, q - 1) == ' ' && !cell_cc(line, q - 1))
           q--;
-        if (q == line->chars + term.cols)
+        if (q == term.cols)
           q--;
-        if (p.x >= q - line->chars)
-          p.x = forward ? term.cols - 1 : q - line->chars;
+        if (p.x >= q)
+          p.x = forward ? term.cols - 1 : q;
       }
       release_line(line);
     }
@@ -293,7 +293,7 @@ get_selpoint(const pos p)
     sp.x = term.post_bidi_cache[p.y].backward[sp.x];
   
   // Back to previous cell if current one is second half of a wide char
-  if (line->chars[sp.x].chr == UCSWIDE)
+  if (cell_chr(line, sp.x) == UCSWIDE)
     sp.x--;
   
   release_line(line);
@@ -430,7 +430,7 @@ term_mouse_release(mouse_button b, mod_keys mods, pos p)
         }
         int cols = term.cols - ((line->attr & LATTR_WRAPPED2) != 0);
         for (int x = p.x; x < cols; x++) {
-          if (line->chars[x].chr != UCSWIDE)
+          if (cell_chr(line, x) != UCSWIDE)
             count++;
         }
         p.y++;
@@ -439,7 +439,7 @@ term_mouse_release(mouse_button b, mod_keys mods, pos p)
       }
       termline *line = fetch_line(p.y);
       for (int x = p.x; x < end.x; x++) {
-        if (line->chars[x].chr != UCSWIDE)
+        if (cell_chr(line, x) != UCSWIDE)
           count++;
       }
       release_line(line);
@@ -13,11 +13,29 @@
 
 #include <sys/termios.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /* This combines two characters into one value, for the purpose of pairing
  * any modifier byte and the final byte in escape sequences.
  */
 #define CPAIR(x, y) ((x) << 8 | (y))
 
+/*
+ * Parser actions. The state transition table that maps the current state
+ * and input byte to one of these and the next state is generated by
+ * tools/mkparsetab.c.
+ */
+typedef enum {
+  A_PRINT, A_EXECUTE, A_IGNORE, A_COLLECT, A_ESC_DISPATCH,
+  A_CSI_ENTER, A_CSI_PARAM, A_CSI_DISPATCH,
+  A_OSC_ENTER, A_OSC_NUM, A_OSC_PALETTE_RESET, A_OSC_PALETTE_PUT,
+  A_REPROCESS, A_CMD_PUT, A_CMD_DISPATCH, A_DCS_ENTER
+} parse_action;
+
+#include "parsetab.h"
+
 static const char primary_da[] = "\e[?1;2c";
 
 /*
@@ -103,20 +121,19 @@ insert_char(int n)
   term_check_boundary(curs->x, curs->y);
   if (dir < 0)
     term_check_boundary(curs->x + n, curs->y);
-  line = term.lines[curs->y];
+  term_damage(curs->y, curs->x, term.cols);
+  line = term_line(curs->y);
   if (dir < 0) {
     for (int j = 0; j < m; j++)
-      move_termchar(line, line->chars + curs->x + j,
-                    line->chars + curs->x + j + n);
+      move_termchar(line, curs->x + j, curs->x + j + n);
     while (n--)
-      line->chars[curs->x + m++] = term.erase_char;
+      set_termchar(line, curs->x + m++, term.erase_char);
   }
   else {
     for (int j = m; j--;)
-      move_termchar(line, line->chars + curs->x + j + n,
-                    line->chars + curs->x + j);
+      move_termchar(line, curs->x + j + n, curs->x + j);
     while (n--)
-      line->chars[curs->x + n] = term.erase_char;
+      set_termchar(line, curs->x + n, term.erase_char);
   }
 }
 
@@ -151,7 +168,7 @@ write_tab(void)
     curs->x++;
   while (curs->x < term.cols - 1 && !term.tabs[curs->x]);
   
-  if ((term.lines[curs->y]->attr & LATTR_MODE) != LATTR_NORM) {
+  if ((term_line(curs->y)->attr & LATTR_MODE) != LATTR_NORM) {
     if (curs->x >= term.cols / 2)
       curs->x = term.cols / 2 - 1;
   }
@@ -179,39 +196,79 @@ write_linefeed(void)
   curs->wrapnext = false;
 }
 
+/*
+ * Combine a zero-width character with the character before the cursor, or
+ * the one under it in wrapnext state.
+ */
 static void
-write_char(wchar c, int width)
+write_combining(termline *line, wchar c)
 {
-  if (!c)
-    return;
-  
   term_cursor *curs = &term.curs;
-  termline *line = term.lines[curs->y];
-  void put_char(wchar c)
-  {
-    clear_cc(line, curs->x);
-    line->chars[curs->x].chr = c;
-    line->chars[curs->x].attr = curs->attr;
-  }  
-
-  if (curs->wrapnext && curs->autowrap && width > 0) {
-    line->attr |= LATTR_WRAPPED;
-    if (curs->y == term.marg_bot)
-      term_do_scroll(term.marg_top, term.marg_bot, 1, true);
-    else if (curs->y < term.rows - 1)
-      curs->y++;
-    curs->x = 0;
-    curs->wrapnext = false;
-    line = term.lines[curs->y];
+  if (curs->x > 0) {
+   /* If we're in wrapnext state, the character
+    * to combine with is _here_, not to our left. */
+    int x = curs->x - !curs->wrapnext;
+   /*
+    * If the previous character is
+    * UCSWIDE, back up another one.
+    */
+    if (cell_chr(line, x) == UCSWIDE) {
+      assert(x > 0);
+      x--;
+    }
+    term_damage(curs->y, x, x + 1);
+   /* Try to precompose with the cell's base codepoint */
+    wchar pc = win_combine_chars(cell_chr(line, x), c);
+    if (pc)
+      cell_chr(line, x) = pc;
+    else
+      add_cc(line, x, c);
   }
-  if (term.insert && width > 0)
-    insert_char(width);
-  switch (width) {
-    when 1:  // Normal character.
-      term_check_boundary(curs->x, curs->y);
-      term_check_boundary(curs->x + 1, curs->y);
-      put_char(c);
-    when 2:  // Double-width character.
+}
+
+/* Move to the start of the next line when wrapping. */
+static void
+write_wrap(void)
+{
+  term_cursor *curs = &term.curs;
+  if (curs->y == term.marg_bot)
+    term_do_scroll(term.marg_top, term.marg_bot, 1, true);
+  else if (curs->y < term.rows - 1)
+    curs->y++;
+  curs->x = 0;
+}
+
+/*
+ * Write a run of characters with given widths. Characters of width 0 are
+ * combined with the preceding one, and those of negative width are ignored.
+ *
+ * The run is split into segments that fit on the current line. For each
+ * segment, wrapping and the line boundaries are dealt with once, and then
+ * the characters are stored without further checks.
+ */
+static void
+write_run(const wchar *run, const schar *widths, int n, uint attr)
+{
+  term_cursor *curs = &term.curs;
+  int i = 0;
+  while (i < n) {
+    int width = widths[i];
+    if (width <= 0) {
+      if (width == 0 && run[i])
+        write_combining(term_line(curs->y), run[i]);
+      i++;
+      continue;
+    }
+
+    if (curs->wrapnext && curs->autowrap) {
+      term_line(curs->y)->attr |= LATTR_WRAPPED;
+      term_damage(curs->y, 0, term.cols);
+      write_wrap();
+      curs->wrapnext = false;
+    }
+    bool insert = term.insert, single = false;
+    termline *line = term_line(curs->y);
+    if (width == 2 && curs->x == term.cols - 1) {
      /*
       * If we're about to display a double-width
       * character starting in the rightmost
@@ -231,53 +288,160 @@ write_char(wchar c, int width)
       * misfortune to start in the wrong parity
       * column. xterm concurs.)
       */
+      if (insert) {
+        // The insertion has happened on this line, so the character
+        // overwrites the start of the next.
+        insert_char(2);
+        insert = false;
+        single = true;
+      }
       term_check_boundary(curs->x, curs->y);
-      term_check_boundary(curs->x + 2, curs->y);
-      if (curs->x == term.cols - 1) {
-        line->chars[curs->x] = term.erase_char;
-        line->attr |= LATTR_WRAPPED | LATTR_WRAPPED2;
-        if (curs->y == term.marg_bot)
-          term_do_scroll(term.marg_top, term.marg_bot, 1, true);
-        else if (curs->y < term.rows - 1)
-          curs->y++;
-        curs->x = 0;
-        line = term.lines[curs->y];
-       /* Now we must term_check_boundary again, of course. */
-        term_check_boundary(curs->x, curs->y);
-        term_check_boundary(curs->x + 2, curs->y);
+      set_termchar(line, curs->x, term.erase_char);
+      line->attr |= LATTR_WRAPPED | LATTR_WRAPPED2;
+      term_damage(curs->y, 0, term.cols);
+      write_wrap();
+      line = term_line(curs->y);
+    }
+
+    // Find the end of the segment, and make room for it in insert mode.
+    int x = curs->x, end = x + width, j = i + 1;
+    if (!single) {
+      for (; j < n && end + widths[j] <= term.cols; j++) {
+        if (widths[j] > 0)
+          end += widths[j];
       }
-      put_char(c);
-      curs->x++;
-      put_char(UCSWIDE);
-    when 0:  // Combining character.
-      if (curs->x > 0) {
-       /* If we're in wrapnext state, the character
-        * to combine with is _here_, not to our left. */
-        int x = curs->x - !curs->wrapnext;
-       /*
-        * If the previous character is
-        * UCSWIDE, back up another one.
-        */
-        if (line->chars[x].chr == UCSWIDE) {
-          assert(x > 0);
-          x--;
+    }
+    if (insert)
+      insert_char(end - x);
+    term_check_boundary(x, curs->y);
+    term_check_boundary(end, curs->y);
+    term_damage(curs->y, x, end);
+
+    for (; i < j; i++) {
+      wchar c = run[i];
+      if (c >= 0x590 && is_rtl(c))  // No RTL characters below Hebrew
+        line->attr |= LATTR_BIDI;
+      switch (widths[i]) {
+        when 1:
+          if (cell_cc(line, x))
+            clear_cc(line, x);
+          cell_chr(line, x) = c;
+          cell_attr(line, x) = attr;
+          x++;
+        when 2:
+          clear_cc(line, x);
+          clear_cc(line, x + 1);
+          cell_chr(line, x) = c;
+          cell_attr(line, x) = attr;
+          cell_chr(line, x + 1) = UCSWIDE;
+          cell_attr(line, x + 1) = attr;
+          x += 2;
+        when 0: {
+          int px = x - 1;
+          if (cell_chr(line, px) == UCSWIDE)
+            px--;
+          wchar pc = win_combine_chars(cell_chr(line, px), c);
+          if (pc)
+            cell_chr(line, px) = pc;
+          else
+            add_cc(line, px, c);
         }
-       /* Try to precompose with the cell's base codepoint */
-        wchar pc = win_combine_chars(line->chars[x].chr, c);
-        if (pc)
-          line->chars[x].chr = pc;
-        else
-          add_cc(line, x, c);
       }
-      return;
-    otherwise:  // Anything else. Probably shouldn't get here.
-      return;
+    }
+
+    if (x == term.cols) {
+      curs->x = x - 1;
+      curs->wrapnext = true;
+    }
+    else
+      curs->x = x;
   }
-  curs->x++;
-  if (curs->x == term.cols) {
-    curs->x--;
-    curs->wrapnext = true;
+}
+
+/* Write a single character with a given width. */
+static void
+write_char(wchar c, int width)
+{
+  if (c)
+    write_run(&c, &(schar){width}, 1, term.curs.attr);
+}
+
+/*
+ * Write a run of printable characters from the input with the given
+ * attributes. Widths are determined here, with surrogate pairs taking the
+ * width of the character they encode, and characters are then translated
+ * according to the current character set.
+ */
+static void
+write_chars(const wchar *run, int n, uint attr)
+{
+  schar widths[n];
+  for (int i = 0; i < n; i++) {
+    wchar c = run[i];
+    if (c < 0x7F)
+      widths[i] = c >= 0x20 ? 1 : -1;
+    else if (is_high_surrogate(c) && i + 1 < n && is_low_surrogate(run[i + 1])) {
+      #if HAS_LOCALES
+      widths[i] = wcswidth(run + i, 2);
+      #else
+      widths[i] = xcwidth(combine_surrogates(c, run[i + 1]));
+      #endif
+      widths[++i] = 0;
+    }
+    else {
+      #if HAS_LOCALES
+      widths[i] = wcwidth(c);
+      #else
+      widths[i] = xcwidth(c);
+      #endif
+    }
+  }
+
+  term_cset cset = term.curs.csets[term.curs.g1];
+  if (cset == CSET_LINEDRW || cset == CSET_GBCHR) {
+    wchar trans[n];
+    for (int i = 0; i < n; i++) {
+      wchar c = run[i];
+      if (cset == CSET_LINEDRW && 0x60 <= c && c <= 0x7E)
+        c = win_linedraw_chars[c - 0x60];
+      else if (cset == CSET_GBCHR && c == '#')
+        c = 0xA3; // pound sign
+      trans[i] = c;
+    }
+    write_run(trans, widths, n, attr);
+  }
+  else
+    write_run(run, widths, n, attr);
+}
+
+/*
+ * Return the length of the run of printable ASCII characters (0x20 to 0x7E)
+ * at the start of a buffer.
+ */
+static uint
+printable_run(const uchar *s, uint len)
+{
+  uint n = 0;
+#ifdef __SSE2__
+ /*
+  * Flipping the top bit turns the printable range into the signed range
+  * -0x60 to -0x02, which can be checked with two signed comparisons.
+  */
+  const __m128i flip = _mm_set1_epi8(0x80);
+  const __m128i lo = _mm_set1_epi8(0x20 - 0x80 - 1);
+  const __m128i hi = _mm_set1_epi8(0x7F - 0x80);
+  while (n + 16 <= len) {
+    __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(s + n)), flip);
+    __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+    uint mask = _mm_movemask_epi8(ok);
+    if (mask != 0xFFFF)
+      return n + __builtin_ctz(~mask);
+    n += 16;
   }
+#endif
+  while (n < len && s[n] >= 0x20 && s[n] < 0x7F)
+    n++;
+  return n;
 }
 
 static void
@@ -326,25 +490,20 @@ do_ctrl(char c)
   return true;
 }
 
+/* Set the size mode of the cursor line, keeping its LATTR_BIDI flag. */
+static void
+set_line_mode(ushort mode)
+{
+  termline *line = term_line(term.curs.y);
+  line->attr = (line->attr & LATTR_BIDI) | mode;
+  term_damage(term.curs.y, 0, term.cols);
+}
+
 static void
 do_esc(uchar c)
 {
   term_cursor *curs = &term.curs;
-  term.state = NORMAL;
   switch (CPAIR(term.esc_mod, c)) {
-    when '[':  /* CSI: control sequence introducer */
-      term.state = CSI_ARGS;
-      term.csi_argc = 1;
-      memset(term.csi_argv, 0, sizeof(term.csi_argv));
-      term.esc_mod = 0;
-    when ']':  /* OSC: operating system command */
-      term.state = OSC_START;
-    when 'P':  /* DCS: device control string */
-      term.state = CMD_STRING;
-      term.cmd_num = -1;
-      term.cmd_len = 0;
-    when '^' or '_': /* PM: privacy message, APC: application program command */
-      term.state = IGNORE_STRING;
     when '7':  /* DECSC: save cursor */
       save_cursor();
     when '8':  /* DECRC: restore cursor */
@@ -376,22 +535,24 @@ do_esc(uchar c)
       term.tabs[curs->x] = true;
     when CPAIR('#', '8'):    /* DECALN: fills screen with Es :-) */
       for (int i = 0; i < term.rows; i++) {
-        termline *line = term.lines[i];
+        termline *line = term_line(i);
         for (int j = 0; j < term.cols; j++) {
-          line->chars[j] =
-            (termchar){.cc_next = 0, .chr = 'E', .attr = ATTR_DEFAULT};
+          set_termchar(line, j,
+            (termchar){.cc_next = 0, .chr = 'E', .attr = ATTR_DEFAULT});
         }
-        line->attr = LATTR_NORM;
+        // Columns beyond the screen width after shrinking are kept.
+        line->attr &= LATTR_BIDI;
       }
       term.disptop = 0;
+      term_damage_all();
     when CPAIR('#', '3'):  /* DECDHL: 2*height, top */
-      term.lines[curs->y]->attr = LATTR_TOP;
+      set_line_mode(LATTR_TOP);
     when CPAIR('#', '4'):  /* DECDHL: 2*height, bottom */
-      term.lines[curs->y]->attr = LATTR_BOT;
+      set_line_mode(LATTR_BOT);
     when CPAIR('#', '5'):  /* DECSWL: normal */
-      term.lines[curs->y]->attr = LATTR_NORM;
+      set_line_mode(LATTR_NORM);
     when CPAIR('#', '6'):  /* DECDWL: 2*width */
-      term.lines[curs->y]->attr = LATTR_WIDE;
+      set_line_mode(LATTR_WIDE);
     when CPAIR('(', 'A') or CPAIR('(', 'B') or CPAIR('(', '0'):
      /* GZD4: G0 designate 94-set */
       curs->csets[0] = c;
@@ -791,9 +952,10 @@ do_csi(uchar c)
       int p = curs->x;
       term_check_boundary(curs->x, curs->y);
       term_check_boundary(curs->x + n, curs->y);
-      termline *line = term.lines[curs->y];
+      term_damage(curs->y, p, p + n);
+      termline *line = term_line(curs->y);
       while (n--)
-        line->chars[p++] = term.erase_char;
+        set_termchar(line, p++, term.erase_char);
     }
     when 'x':        /* DECREQTPARM: report terminal characteristics */
       child_printf("\e[%c;1;1;112;112;1;0x", '2' + arg0);
@@ -969,6 +1131,14 @@ do_cmd(void)
       *s = 0;
       child_printf("\e]7771;!%s\e\\", term.cmd_buf);
     }
+    when 7772:  // Enquire about scrollback memory use
+      if (!strcmp(s, "?")) {
+        sbstats st;
+        scrollback_stats(&st);
+        child_printf("\e]7772;lines=%d;bytes=%zu;spilled=%zu;dedup=%d\e\\",
+                     st.lines, st.stored_bytes, st.spilled_bytes,
+                     st.dedup_lines);
+      }
   }
 }
 
@@ -1055,9 +1225,31 @@ term_write(const char *buf, uint len)
       }
     }
 
-    switch (term.state) {
-      when NORMAL: {
+    uchar t = parse_table[term.state][c];
+    term.state = t >> 4;
+    switch ((parse_action)(t & 0xF)) {
+      when A_PRINT: {
         
+       /*
+        * Fast path for runs of printable ASCII characters, which don't
+        * need decoding.
+        */
+        if (c >= 0x20 && c < 0x7F && !term.printing && !term.curs.oem_acs &&
+            !term.in_mb_char && !term.high_surrogate) {
+          uint n = printable_run((const uchar *)buf + pos, len - pos) + 1;
+          pos--;
+          while (n) {
+            wchar ws[256];
+            uint wn = min(n, lengthof(ws));
+            for (uint i = 0; i < wn; i++)
+              ws[i] = buf[pos + i];
+            write_chars(ws, wn, term.curs.attr);
+            pos += wn;
+            n -= wn;
+          }
+          continue;
+        }
+
         wchar wc;
 
         if (term.curs.oem_acs && !memchr("\e\n\r\b", c, 4)) {
@@ -1067,6 +1259,29 @@ term_write(const char *buf, uint len)
           continue;
         }
         
+       /*
+        * With UTF-8, decode everything up to the next control character
+        * in one go, instead of byte by byte.
+        */
+        if (cs_utf8 && !term.printing && (c >= 0x80 || term.in_mb_char)) {
+          if (term.high_surrogate) {
+            write_error();
+            term.high_surrogate = 0;
+          }
+          wchar ws[256];
+          uint wn = lengthof(ws);
+          int status;
+          pos--;
+          pos += cs_utf8_decode(buf + pos, len - pos, ws, &wn, &status);
+          // Nothing is decoded if the input ends within a sequence.
+          if (wn)
+            write_chars(ws, wn, term.curs.attr);
+          term.in_mb_char = status == -2;
+          if (status == -1)
+            write_error();
+          continue;
+        }
+
         switch (cs_mb1towc(&wc, c)) {
           when 0: // NUL or low surrogate
             if (wc)
@@ -1091,15 +1306,8 @@ term_write(const char *buf, uint len)
         term.high_surrogate = 0;
         
         if (is_low_surrogate(wc)) {
-          if (hwc) {
-            #if HAS_LOCALES
-            int width = wcswidth((wchar[]){hwc, wc}, 2);
-            #else
-            int width = xcwidth(combine_surrogates(hwc, wc));
-            #endif
-            write_char(hwc, width);
-            write_char(wc, 0);
-          }
+          if (hwc)
+            write_chars((wchar[]){hwc, wc}, 2, term.curs.attr);
           else
             write_error();
           continue;
@@ -1124,128 +1332,61 @@ term_write(const char *buf, uint len)
         }
 
         // Everything else
-        #if HAS_LOCALES
-        int width = wcwidth(wc);
-        #else
-        int width = xcwidth(wc);
-        #endif
-        
-        switch(term.curs.csets[term.curs.g1]) {
-          when CSET_LINEDRW:
-            if (0x60 <= wc && wc <= 0x7E)
-              wc = win_linedraw_chars[wc - 0x60];
-          when CSET_GBCHR:
-            if (c == '#')
-              wc = 0xA3; // pound sign
-          otherwise: ;
-        }
-        write_char(wc, width);
+        write_chars(&wc, 1, term.curs.attr);
       }
-      when ESCAPE or CMD_ESCAPE:
-        if (c < 0x20)
-          do_ctrl(c);
-        else if (c < 0x30)
-          term.esc_mod = term.esc_mod ? 0xFF : c;
-        else if (c == '\\' && term.state == CMD_ESCAPE) {
-          /* Process DCS or OSC sequence if we see ST. */
-          do_cmd();
-          term.state = NORMAL;
-        }
-        else
-          do_esc(c);
-      when CSI_ARGS:
-        if (c < 0x20)
-          do_ctrl(c);
-        else if (c == ';') {
+      when A_EXECUTE:
+        do_ctrl(c);
+      when A_IGNORE:
+        // Nothing to do other than changing state.
+      when A_COLLECT:
+        term.esc_mod = term.esc_mod ? 0xFF : c;
+      when A_ESC_DISPATCH:
+        do_esc(c);
+      when A_CSI_ENTER:
+        term.csi_argc = 1;
+        memset(term.csi_argv, 0, sizeof(term.csi_argv));
+        term.esc_mod = 0;
+      when A_CSI_PARAM:
+        if (c == ';') {
           if (term.csi_argc < lengthof(term.csi_argv))
             term.csi_argc++;
         }
-        else if (c >= '0' && c <= '9') {
+        else {
           uint i = term.csi_argc - 1;
           if (i < lengthof(term.csi_argv))
             term.csi_argv[i] = 10 * term.csi_argv[i] + c - '0';
         }
-        else if (c < 0x40)
-          term.esc_mod = term.esc_mod ? 0xFF : c;
-        else {
-          do_csi(c);
-          term.state = NORMAL;
-        }
-      when OSC_START:
+      when A_CSI_DISPATCH:
+        do_csi(c);
+      when A_OSC_ENTER:
+        term.cmd_num = 0;
         term.cmd_len = 0;
-        switch (c) {
-          when 'P':  /* Linux palette sequence */
-            term.state = OSC_PALETTE;
-          when 'R':  /* Linux palette reset */
-            win_reset_colours();
-            term.state = NORMAL;
-          when '0' ... '9':  /* OSC command number */
-            term.cmd_num = c - '0';
-            term.state = OSC_NUM;
-          when ';':
-            term.cmd_num = 0;
-            term.state = CMD_STRING;
-          when '\a' or '\n' or '\r':
-            term.state = NORMAL;
-          when '\e':
-            term.state = ESCAPE;
-          otherwise:
-            term.state = IGNORE_STRING;
-        }
-      when OSC_NUM:
-        switch (c) {
-          when '0' ... '9':  /* OSC command number */
-            term.cmd_num = term.cmd_num * 10 + c - '0';
-          when ';':
-            term.state = CMD_STRING;
-          when '\a' or '\n' or '\r':
-            term.state = NORMAL;
-          when '\e':
-            term.state = ESCAPE;
-          otherwise:
-            term.state = IGNORE_STRING;
-        }
-      when OSC_PALETTE:
-        if (isxdigit(c)) {
-          // The dodgy Linux palette sequence: keep going until we have
-          // seven hexadecimal digits.
-          term.cmd_buf[term.cmd_len++] = c;
-          if (term.cmd_len == 7) {
-            uint n, r, g, b;
-            sscanf(term.cmd_buf, "%1x%2x%2x%2x", &n, &r, &g, &b);
-            win_set_colour(n, make_colour(r, g, b));
-            term.state = NORMAL;
-          }
-        }
-        else {
-          // End of sequence. Put the character back unless the sequence was 
-          // terminated properly.
+      when A_OSC_NUM:
+        term.cmd_num = term.cmd_num * 10 + c - '0';
+      when A_OSC_PALETTE_RESET:
+        win_reset_colours();
+      when A_OSC_PALETTE_PUT:
+        // The dodgy Linux palette sequence: keep going until we have
+        // seven hexadecimal digits.
+        term.cmd_buf[term.cmd_len++] = c;
+        if (term.cmd_len == 7) {
+          uint n, r, g, b;
+          sscanf(term.cmd_buf, "%1x%2x%2x%2x", &n, &r, &g, &b);
+          win_set_colour(n, make_colour(r, g, b));
           term.state = NORMAL;
-          if (c != '\a') {
-            pos--;
-            continue;
-          }
-        }
-      when CMD_STRING:
-        switch (c) {
-          when '\n' or '\r':
-            term.state = NORMAL;
-          when '\a':
-            do_cmd();
-            term.state = NORMAL;
-          when '\e':
-            term.state = CMD_ESCAPE;
-          otherwise:
-            if (term.cmd_len < lengthof(term.cmd_buf) - 1)
-              term.cmd_buf[term.cmd_len++] = c;
-        }
-      when IGNORE_STRING:
-        switch (c) {
-          when '\n' or '\r' or '\a':
-            term.state = NORMAL;
-          when '\e':
-            term.state = ESCAPE;
         }
+      when A_REPROCESS:
+        // End of sequence. Put the character back.
+        pos--;
+      when A_CMD_PUT:
+        if (term.cmd_len < lengthof(term.cmd_buf) - 1)
+          term.cmd_buf[term.cmd_len++] = c;
+      when A_CMD_DISPATCH:
+        /* Process DCS or OSC sequence if we see ST or BEL. */
+        do_cmd();
+      when A_DCS_ENTER:
+        term.cmd_num = -1;
+        term.cmd_len = 0;
     }
   }
   win_schedule_update();
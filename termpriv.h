@@ -19,12 +19,88 @@
 #define posPlt(p1,p2) ((p1).y <= (p2).y && (p1).x < (p2).x)
 #define posPle(p1,p2) ((p1).y <= (p2).y && (p1).x <= (p2).x)
 
+/*
+ * The screens are rings of lines, so that scrolling all of a screen only
+ * needs to move the ring index of its top line. Screen line y is at ring
+ * index ring_index(top, y).
+ */
+static inline int
+ring_index(int top, int y)
+{
+  int i = top + y;
+  return i < term.rows ? i : i - term.rows;
+}
+
+#define term_line_slot(y) (term.lines[ring_index(term.lines_top, (y))])
+
+/* Screen line y, ready for its cells to be accessed and changed. */
+static inline termline *
+term_line(int y)
+{
+  termline *line = term_line_slot(y);
+  if (line->cleared)
+    line = term_line_slot(y) = fill_cleared(line);
+  return line;
+}
+
 void term_print_finish(void);
 
 void term_schedule_tblink(void);
 void term_schedule_cblink(void);
 void term_schedule_vbell(int already_started, int startpoint);
 
+void term_damage(int y, int left, int right);
+void term_damage_all(void);
+
+termline *scrollback_push(termline *);
+termline *scrollback_pop(void);
+termline *scrollback_staged(int n);
+uchar *scrollback_line(int n);
+void scrollback_clear(void);
+void scrollback_flush(void);
+
+int reflow_screen(int cols);
+void scrollback_reflow(int rows, int cols);
+
+typedef struct sbreader sbreader;
+sbreader *sbreader_new(void);
+void sbreader_reset(sbreader *);
+void sbreader_free(sbreader *);
+uchar *sbreader_line(sbreader *, int n);
+
+typedef struct sbstash sbstash;
+sbstash *sbstash_new(void);
+void sbstash_push(sbstash *, uchar *data, int len);
+uchar *sbstash_pop(sbstash *);
+void sbstash_free(sbstash *);
+
+/* Scrollback memory accounting */
+typedef struct {
+  int lines;
+  size_t rle_bytes;      /* size of the lines in compressline() format */
+  size_t stored_bytes;   /* bytes actually used to store them */
+  size_t spilled_bytes;  /* of which in the spill file */
+  int dedup_lines;       /* lines sharing the data of another line */
+} sbstats;
+
+void scrollback_stats(sbstats *);
+
+/* Line pool usage of the calling thread, see termline.c */
+typedef struct {
+  unsigned long line_hits, line_misses;
+  unsigned long cells_hits, cells_misses;
+} poolstats;
+
+void line_pool_stats(poolstats *);
+
+void sbindex_add(int n, termline *);
+void sbindex_remove(int n);
+void sbindex_clear(void);
+void sbscan_wait(void);
+
+void sbcache_invalidate(int n);
+void sbcache_clear(void);
+
 void term_switch_screen(bool to_alt, bool reset);
 void term_check_boundary(int x, int y);
 void term_do_scroll(int topline, int botline, int lines, bool sb);
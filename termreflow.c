@@ -0,0 +1,273 @@
+// termreflow.c (part of mintty)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+/*
+ * Rewrapping lines when the terminal width changes.
+ *
+ * Lines joined by LATTR_WRAPPED form logical lines, which are laid out
+ * afresh at the new width. The screen is done straight away by
+ * term_resize(), but the scrollback only on demand, because rewrapping a
+ * long history on every step of a window drag would stall it.
+ * term.sbreflow is the absolute number of the first scrollback line known
+ * to be at the current width, and scrollback_reflow() moves it back when
+ * older lines are about to be shown, selected, searched or exported.
+ * Lines before it are shown truncated or padded, as fetch_line() has
+ * always done.
+ *
+ * The scrollback can only be changed at its newest end, so extending the
+ * reflowed range means taking off everything down to the start of the
+ * range and putting it back. To keep the total work in proportion to the
+ * history, the range is at least doubled each time.
+ */
+
+#include "termpriv.h"
+
+typedef struct {
+  termline **lines;
+  int count, size;
+} linelist;
+
+static void
+add_line(linelist *l, termline *line)
+{
+  if (l->count == l->size) {
+    l->size = max(16, l->size * 2);
+    l->lines = renewn(l->lines, l->size);
+  }
+  l->lines[l->count++] = line;
+}
+
+static bool
+blank_char(termline *line, int x)
+{
+  return cell_chr(line, x) == ' ' && !cell_cc(line, x) &&
+         cell_attr(line, x) == ATTR_DEFAULT;
+}
+
+/*
+ * Lay out the logical lines made up of in[0] to in[n - 1] at the given
+ * width, adding the resulting lines to out, which take their attributes
+ * from the first line of each logical line. The input is left alone.
+ * Marks whose y coordinate indexes the input are moved to the
+ * corresponding position, with y indexing out instead.
+ */
+static void
+reflow_lines(termline **in, int n, int cols, linelist *out,
+             pos **marks, int nmarks)
+{
+  bool mapped[nmarks + 1];
+  for (int m = 0; m < nmarks; m++)
+    mapped[m] = false;
+
+  for (int i = 0; i < n;) {
+    if ((in[i]->attr & LATTR_MODE) != LATTR_NORM) {
+     /* Double-width lines don't wrap, so they're merely cut or padded. */
+      termline *line = copyline(in[i]);
+      line->temporary = false;
+      resizeline(line, cols);
+      for (int m = 0; m < nmarks; m++) {
+        if (!mapped[m] && marks[m]->y == i) {
+          marks[m]->y = out->count;
+          marks[m]->x = min(marks[m]->x, cols - 1);
+          mapped[m] = true;
+        }
+      }
+      add_line(out, line);
+      i++;
+      continue;
+    }
+
+    int j = i;
+    while (j + 1 < n && (in[j]->attr & LATTR_WRAPPED) &&
+           (in[j + 1]->attr & LATTR_MODE) == LATTR_NORM)
+      j++;
+
+    int attr = 0;
+    for (int k = i; k <= j; k++)
+      attr |= in[k]->attr & LATTR_BIDI;
+
+    termline *line = newline(cols, false);
+    line->attr = attr;
+    int ox = 0;
+    for (int k = i; k <= j; k++) {
+      termline *src = in[k];
+      int end = src->cols;
+      if (src->attr & LATTR_WRAPPED) {
+       /* The last cell of a WRAPPED2 line is filler. */
+        if (src->attr & LATTR_WRAPPED2)
+          end--;
+      }
+      else {
+        while (end > 0 && blank_char(src, end - 1))
+          end--;
+      }
+     /* Keep the cells under marks, so that they don't get lost. */
+      for (int m = 0; m < nmarks; m++)
+        if (!mapped[m] && marks[m]->y == k)
+          end = max(end, min(marks[m]->x + 1, src->cols));
+
+      for (int x = 0; x < end; x++) {
+        if (cell_chr(src, x) == UCSWIDE && x > 0)
+          continue;
+        int width =
+          x + 1 < src->cols && cell_chr(src, x + 1) == UCSWIDE && cols > 1
+          ? 2 : 1;
+        if (ox + width > cols) {
+          line->attr |= LATTR_WRAPPED | (ox < cols ? LATTR_WRAPPED2 : 0);
+          add_line(out, line);
+          line = newline(cols, false);
+          line->attr = attr;
+          ox = 0;
+        }
+        copy_termchar(line, ox, src, x);
+        if (width == 2)
+          copy_termchar(line, ox + 1, src, x + 1);
+        for (int m = 0; m < nmarks; m++) {
+          pos *p = marks[m];
+          if (!mapped[m] && p->y == k && x <= p->x && p->x < x + width) {
+            p->x = ox + p->x - x;
+            p->y = out->count;
+            mapped[m] = true;
+          }
+        }
+        ox += width;
+      }
+      for (int m = 0; m < nmarks; m++) {
+        if (!mapped[m] && marks[m]->y == k) {
+          marks[m]->x = min(ox, cols - 1);
+          marks[m]->y = out->count;
+          mapped[m] = true;
+        }
+      }
+    }
+    add_line(out, line);
+    i = j + 1;
+  }
+}
+
+/*
+ * Rewrap the screen for a new width, together with any scrollback lines
+ * that wrap onto it. Returns the resulting number of screen lines, which
+ * the caller needs to fit to the screen height.
+ */
+int
+reflow_screen(int cols)
+{
+  linelist in = {0};
+
+  // Take back the scrollback lines that are part of the first logical line
+  // on the screen. They come out newest first.
+  int end = term.sbfirst + term.sblines;
+  while (term.sblines &&
+         decompressline_attr(scrollback_line(end - 1)) & LATTR_WRAPPED) {
+    add_line(&in, scrollback_pop());
+    end--;
+  }
+  int popped = in.count;
+  for (int i = 0; i < popped / 2; i++) {
+    termline *line = in.lines[i];
+    in.lines[i] = in.lines[popped - 1 - i];
+    in.lines[popped - 1 - i] = line;
+  }
+  for (int i = 0; i < term.rows; i++)
+    add_line(&in, term_line(i));
+
+  term_cursor *curs = &term.curs;
+  term_cursor *saved_curs = &term.saved_cursors[term.on_alt_screen];
+  pos curs_pos = {.y = curs->y + popped, .x = curs->x};
+  pos saved_pos = {.y = saved_curs->y + popped, .x = saved_curs->x};
+
+  linelist out = {0};
+  reflow_lines(in.lines, in.count, cols, &out,
+               (pos *[]){&curs_pos, &saved_pos}, 2);
+
+  for (int i = 0; i < in.count; i++)
+    freeline(in.lines[i]);
+  free(in.lines);
+  free(term.lines);
+
+  term.lines = out.lines;
+  term.lines_top = 0;
+  curs->y = curs_pos.y;
+  curs->x = curs_pos.x;
+  saved_curs->y = saved_pos.y;
+  saved_curs->x = saved_pos.x;
+
+  // The rest of the scrollback is left for later.
+  term.sbreflow = term.sbfirst + term.sblines;
+
+  return out.count;
+}
+
+/*
+ * Rewrap scrollback lines from absolute number target, which starts a
+ * logical line, up to the stale range's end at start.
+ */
+static void
+reflow_range(int target, int start, int cols)
+{
+  // Take the lines off, keeping them compressed in the meantime. They come
+  // back out of the stash oldest first.
+  int tempsblines = term.tempsblines;
+  int count = term.sbfirst + term.sblines - target;
+  sbstash *stash = sbstash_new();
+  uchar *data = 0;
+  int size = 0;
+  for (int i = count; i--;) {
+    termline *line = scrollback_pop();
+    sbstash_push(stash, data, compressline(line, &data, &size));
+    freeline(line);
+  }
+  free(data);
+
+  // Put them back, rewrapping the stale ones a logical line at a time.
+  linelist in = {0}, out = {0};
+  int i = 0;
+  for (int stale = start - target; i < stale;) {
+    do
+      add_line(&in, decompressline(sbstash_pop(stash), 0));
+    while (in.lines[in.count - 1]->attr & LATTR_WRAPPED && ++i < stale);
+    if (i < stale)
+      i++;
+    reflow_lines(in.lines, in.count, cols, &out, 0, 0);
+    for (int k = 0; k < in.count; k++)
+      freeline(in.lines[k]);
+    for (int k = 0; k < out.count; k++)
+      freeline(scrollback_push(out.lines[k]));
+    in.count = out.count = 0;
+  }
+  for (; i < count; i++) {
+    termline *line = decompressline(sbstash_pop(stash), 0);
+    line->temporary = false;
+    freeline(scrollback_push(line));
+  }
+  sbstash_free(stash);
+  free(in.lines);
+  free(out.lines);
+
+  term.sbreflow = target;
+  term.tempsblines = min(tempsblines, term.sblines);
+}
+
+/*
+ * Make sure that at least the newest `rows' scrollback lines are at the
+ * given width.
+ */
+void
+scrollback_reflow(int rows, int cols)
+{
+  for (;;) {
+    int end = term.sbfirst + term.sblines;
+    int start = min(max(term.sbreflow, term.sbfirst), end);
+    if (start <= max(term.sbfirst, end - rows))
+      return;
+
+    // Widening leaves fewer lines than were taken off, in which case this
+    // needs to go round again.
+    int target = max(term.sbfirst, end - max(rows, 2 * (end - start)));
+    while (target > term.sbfirst &&
+           decompressline_attr(scrollback_line(target - 1)) & LATTR_WRAPPED)
+      target--;
+    reflow_range(target, start, cols);
+  }
+}
@@ -0,0 +1,1206 @@
+// termsb.c (part of mintty)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+/*
+ * Scrollback storage. Lines scrolled off the top of the screen are
+ * compressed with compressline() and collected in groups of
+ * SB_GROUP_LINES lines. Once a group is full, it is sealed by compressing
+ * the lines' data together with a simple LZ77 coder, which picks up the
+ * redundancy between lines that the per-line RLE format can't see.
+ * Sealed groups are stored back to back in large blocks.
+ *
+ * Lines are identified by their absolute number, which counts up from the
+ * first line pushed since the scrollback was last cleared, and group g
+ * holds lines g * SB_GROUP_LINES to (g + 1) * SB_GROUP_LINES - 1. A ring
+ * of 32-bit offsets gives the position of each line within the
+ * uncompressed data of its group.
+ *
+ * Repeated lines are stored only once. A line whose data matches that of
+ * a line still in the scrollback is kept in a reference-counted shared
+ * entry instead, which is looked up by a hash of the data. Offsets with
+ * the SB_SHARED bit set hold the index of such an entry.
+ *
+ * Blocks and groups are kept in order of age. A group is dropped once all
+ * its lines have been thrown away to make space, and a block is freed once
+ * all its groups are gone. Popping lines back onto the screen unseals the
+ * newest group again if necessary.
+ *
+ * The ScrollbackLines option limits the number of lines kept, and the
+ * ScrollbackBytes option the number of bytes of compressed data. The
+ * latter is enforced by dropping whole groups, so the newest group is
+ * always kept.
+ *
+ * Stored lines are also added to the search index in termsearch.c.
+ *
+ * Lines aren't compressed straight away when they are pushed. Instead, they
+ * are put in a staging queue, and a worker thread compresses them in
+ * batches. They are moved into storage once compressed, next time a line
+ * is pushed, or when their compressed data is needed. In the meantime,
+ * fetch_line() copies them directly from the queue.
+ *
+ * If the ScrollbackMemory option is set and the blocks take up more than
+ * that many bytes, the oldest ones are spilled to a temporary file and
+ * mapped back into memory read-only. The file is unlinked as soon as it
+ * has been created, so it goes away when mintty exits.
+ */
+
+#include "termpriv.h"
+
+#include "config.h"
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <pthread.h>
+
+#define SB_BLOCK_SIZE 0x10000
+#define SB_GROUP_LINES 256
+
+typedef struct {
+  int groups;  /* number of groups stored in the block */
+  uint size;   /* size of data */
+  uint used;   /* bytes of data used */
+  uchar *data; /* heap memory, or mapped from the spill file */
+  off_t pos;   /* position in the spill file, or -1 if not spilled */
+} sbblock;
+
+typedef struct {
+  sbblock *block;  /* block holding the group */
+  uint pos;        /* position of the group's data in the block */
+  uint size;       /* LZ compressed size */
+  uint raw_size;   /* size of the lines' compressline() data */
+} sbgroup;
+
+static sbblock **blocks;
+static int block_count, blocks_size;
+static size_t heap_bytes;  /* size of blocks that haven't been spilled */
+
+/* Sizes of the scrollback's compressline() data and of its stored form. */
+static size_t rle_bytes, stored_bytes, spilled_bytes;
+
+#define SB_SHARED 0x80000000u
+
+typedef struct {
+  uint hash;
+  uint refs;    /* number of lines referring to the entry, 0 if free */
+  uint len;
+  int next;     /* next entry in the hash chain or free list, or -1 */
+  uchar *data;
+} sbshared;
+
+static sbshared *shared;
+static int shared_count, shared_size;  /* entries used, and allocated */
+static int shared_free = -1;           /* free list */
+static int *buckets;                   /* hash chain heads, or -1 */
+static uint bucket_mask;
+static int dedup_lines;                /* lines referring to shared data */
+
+/*
+ * Newest line with a given hash, by absolute line number plus one. Used
+ * to spot the first repeat of a line that isn't shared yet.
+ */
+#define SB_RECENT_BITS 10
+static struct {
+  int n;
+  uint hash, len;
+} recent[1 << SB_RECENT_BITS];
+
+static sbgroup *groups;
+static int group_count, groups_size;
+static int first_group;  /* group number of groups[0] */
+
+static uint *offsets;    /* ring of line offsets within their group */
+static int offsets_len;  /* length of the offsets ring */
+static int offsets_pos;  /* index of next offsets position to be filled */
+
+/* The compressline() data of the newest group, which isn't sealed yet. */
+static uchar *open_data;
+static uint open_len, open_size;
+
+/* Scratch buffer for compressing groups. */
+static uchar *buf;
+static int buf_size;
+
+/* The most recently used sealed group, decompressed as far as needed. */
+typedef struct {
+  int group;        /* group number, or -1 if none */
+  uchar *data;
+  uint len, size;   /* bytes decompressed so far, and allocated */
+  uint in_pos;      /* bytes of the compressed data read so far */
+} lzstate;
+
+static lzstate decoded = {.group = -1};
+
+
+/*
+ * LZ77 coder, in the style of LZ4. The compressed data is a sequence of
+ * literal runs and back references. Each starts with a token byte whose
+ * high nibble is the number of literals and low nibble the match length
+ * minus LZ_MIN_MATCH, with 15 meaning that further length bytes follow,
+ * each adding up to 255. Then come the literals, a 16-bit little-endian
+ * match offset and the extra match length bytes. The last sequence has
+ * literals only.
+ */
+
+#define LZ_MIN_MATCH 4
+#define LZ_MAX_OFFSET 0xFFFF
+#define LZ_HASH_BITS 12
+
+/* Worst-case compressed size of n bytes. */
+#define lz_bound(n) ((n) + (n) / 255 + 16)
+
+static uint
+lz_hash(const uchar *p)
+{
+  uint v;
+  memcpy(&v, p, sizeof v);
+  return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+/*
+ * Compress n bytes from src into dst, which needs room for lz_bound(n)
+ * bytes. Returns the compressed size.
+ */
+static uint
+lz_compress(const uchar *src, uint n, uchar *dst)
+{
+  uint table[1 << LZ_HASH_BITS];  /* positions + 1, or 0 if unused */
+  memset(table, 0, sizeof table);
+
+  const uchar *p = src, *anchor = src, *end = src + n;
+  uchar *out = dst;
+
+  void put_length(uint len) {
+    for (; len >= 255; len -= 255)
+      *out++ = 255;
+    *out++ = len;
+  }
+
+  void put_literals(uint match_len) {
+    uint lits = p - anchor;
+    *out++ = min(lits, 15) << 4 | min(match_len, 15);
+    if (lits >= 15)
+      put_length(lits - 15);
+    memcpy(out, anchor, lits);
+    out += lits;
+  }
+
+  while (end - p >= LZ_MIN_MATCH) {
+    uint h = lz_hash(p);
+    uint pos = p - src, cand = table[h];
+    table[h] = pos + 1;
+    if (!cand || pos - (cand - 1) > LZ_MAX_OFFSET ||
+        memcmp(src + cand - 1, p, LZ_MIN_MATCH)) {
+      p++;
+      continue;
+    }
+    const uchar *m = src + cand - 1;
+
+    uint len = LZ_MIN_MATCH;
+    while (p + len < end && m[len] == p[len])
+      len++;
+
+    put_literals(len - LZ_MIN_MATCH);
+    uint offset = p - m;
+    *out++ = offset;
+    *out++ = offset >> 8;
+    if (len - LZ_MIN_MATCH >= 15)
+      put_length(len - LZ_MIN_MATCH - 15);
+
+    // Remember the positions within the match too, for better matches
+    // between similar lines.
+    for (const uchar *q = p + 1; q < p + len && end - q >= LZ_MIN_MATCH; q++)
+      table[lz_hash(q)] = q - src + 1;
+    p += len;
+    anchor = p;
+  }
+
+  p = end;
+  put_literals(0);
+  return out - dst;
+}
+
+/*
+ * Continue decompressing src, of size n, into s until at least `want'
+ * bytes are available. s->data must have room for all of the data.
+ */
+static void
+lz_decompress(lzstate *s, const uchar *src, uint n, uint want)
+{
+  const uchar *in = src + s->in_pos, *end = src + n;
+  uchar *out = s->data + s->len;
+
+  uint get_length(uint len) {
+    if (len == 15) {
+      uint c;
+      do
+        len += c = *in++;
+      while (c == 255);
+    }
+    return len;
+  }
+
+  while ((uint)(out - s->data) < want && in < end) {
+    uint token = *in++;
+    uint lits = get_length(token >> 4);
+    memcpy(out, in, lits);
+    out += lits;
+    in += lits;
+    if (in == end)
+      break;
+
+    uint offset = in[0] | in[1] << 8;
+    in += 2;
+    uint len = get_length(token & 15) + LZ_MIN_MATCH;
+    const uchar *m = out - offset;
+    while (len--)
+      *out++ = *m++;  // Matches can overlap their own output.
+  }
+
+  s->len = out - s->data;
+  s->in_pos = in - src;
+}
+
+
+/*
+ * Spill file. It is carved into slots of SB_BLOCK_SIZE bytes, which also
+ * satisfies the 64 KiB mapping granularity on Windows. Larger blocks are
+ * appended in multiple slots. Slots of freed blocks are reused.
+ */
+static int spill_fd = -1;
+static off_t spill_len;
+static off_t *free_slots;
+static int free_slot_count, free_slots_size;
+static bool spill_failed;
+
+static bool
+open_spill_file(void)
+{
+  if (spill_fd >= 0)
+    return true;
+  if (spill_failed)
+    return false;
+  string dir = getenv("TMPDIR");
+  char *name = asform("%s/mintty-sb-XXXXXX", dir && *dir ? dir : "/tmp");
+  spill_fd = mkstemp(name);
+  if (spill_fd >= 0) {
+    unlink(name);
+   /* Keep children, such as new windows, from holding on to the file. */
+    fcntl(spill_fd, F_SETFD, FD_CLOEXEC);
+  }
+  else
+    spill_failed = true;
+  free(name);
+  return spill_fd >= 0;
+}
+
+static uint
+slot_size(uint size)
+{
+  return (size + SB_BLOCK_SIZE - 1) & ~(SB_BLOCK_SIZE - 1);
+}
+
+/* Write the block's data to the spill file and map it back in. */
+static bool
+spill_block(sbblock *block)
+{
+  if (!open_spill_file())
+    return false;
+
+  off_t pos;
+  bool reused = block->size <= SB_BLOCK_SIZE && free_slot_count;
+  if (reused)
+    pos = free_slots[--free_slot_count];
+  else
+    pos = spill_len;
+
+  uchar *data = 0;
+  if (pwrite(spill_fd, block->data, block->used, pos) == (ssize_t)block->used)
+    data = mmap(0, block->used, PROT_READ, MAP_SHARED, spill_fd, pos);
+  if (!data || data == MAP_FAILED) {
+    if (reused)
+      free_slot_count++;
+    return false;
+  }
+  if (!reused)
+    spill_len += slot_size(block->size);
+
+  free(block->data);
+  heap_bytes -= block->size;
+  spilled_bytes += block->used;
+  block->data = data;
+  block->pos = pos;
+  return true;
+}
+
+static void
+free_block(sbblock *block)
+{
+  if (block->pos < 0) {
+    free(block->data);
+    heap_bytes -= block->size;
+  }
+  else {
+    munmap(block->data, block->used);
+    spilled_bytes -= block->used;
+    for (uint i = 0; i < slot_size(block->size); i += SB_BLOCK_SIZE) {
+      if (free_slot_count == free_slots_size) {
+        free_slots_size = free_slots_size * 2 + 16;
+        free_slots = renewn(free_slots, free_slots_size);
+      }
+      free_slots[free_slot_count++] = block->pos + i;
+    }
+  }
+  free(block);
+}
+
+/*
+ * Spill the oldest blocks still on the heap while over budget. The newest
+ * block is kept, as it is still being filled.
+ */
+static void
+spill_blocks(void)
+{
+  if (!cfg.scrollback_memory)
+    return;
+  for (int i = 0;
+       i < block_count - 1 && heap_bytes > (size_t)cfg.scrollback_memory;
+       i++) {
+    if (blocks[i]->pos < 0 && !spill_block(blocks[i]))
+      break;
+  }
+}
+
+
+static uint
+line_hash(const uchar *data, int len)
+{
+  uint h = 2166136261u;
+  for (int i = 0; i < len; i++)
+    h = (h ^ data[i]) * 16777619u;
+  return h;
+}
+
+static sbshared *
+find_shared(uint hash, const uchar *data, int len)
+{
+  if (!buckets)
+    return 0;
+  for (int i = buckets[hash & bucket_mask]; i >= 0; i = shared[i].next) {
+    sbshared *e = &shared[i];
+    if (e->hash == hash && e->len == (uint)len && !memcmp(e->data, data, len))
+      return e;
+  }
+  return 0;
+}
+
+static sbshared *
+add_shared(uint hash, const uchar *data, int len)
+{
+  int i;
+  if (shared_free >= 0) {
+    i = shared_free;
+    shared_free = shared[i].next;
+  }
+  else {
+    if (shared_count == shared_size) {
+      shared_size = shared_size * 2 + 64;
+      shared = renewn(shared, shared_size);
+    }
+    i = shared_count++;
+  }
+
+  if (shared_count > (int)bucket_mask) {
+    // Rehash into twice as many buckets
+    bucket_mask = bucket_mask * 2 + 1;
+    buckets = renewn(buckets, bucket_mask + 1);
+    memset(buckets, -1, (bucket_mask + 1) * sizeof *buckets);
+    for (int j = 0; j < shared_count; j++) {
+      if (j != i && shared[j].refs) {
+        int *head = &buckets[shared[j].hash & bucket_mask];
+        shared[j].next = *head;
+        *head = j;
+      }
+    }
+  }
+
+  int *head = &buckets[hash & bucket_mask];
+  shared[i] = (sbshared){
+    .hash = hash, .len = len, .next = *head,
+    .data = memcpy(newn(uchar, len), data, len)
+  };
+  *head = i;
+  stored_bytes += len;
+  return &shared[i];
+}
+
+/* Let go of a line's offset, freeing its shared entry if it has one. */
+static void
+release_offset(uint offset)
+{
+  if (!(offset & SB_SHARED))
+    return;
+  int i = offset & ~SB_SHARED;
+  sbshared *e = &shared[i];
+  rle_bytes -= e->len;
+  dedup_lines--;
+  if (--e->refs)
+    return;
+
+  int *p = &buckets[e->hash & bucket_mask];
+  while (*p != i)
+    p = &shared[*p].next;
+  *p = e->next;
+  free(e->data);
+  stored_bytes -= e->len;
+  e->next = shared_free;
+  shared_free = i;
+}
+
+
+/*
+ * Staging queue of lines waiting to be compressed by the worker thread.
+ * Its indices count up and wrap round. Lines from stage_tail to stage_done
+ * have been compressed, and the worker may be working on those from
+ * stage_done to stage_head. The indices that the worker uses are protected
+ * by stage_mutex.
+ */
+#define SB_STAGE_LINES 1024
+#define SB_STAGE_BATCH 64
+
+typedef struct {
+  termline *line;
+  uchar *data;  /* compressline() data, once compressed */
+  int len, size;
+} sbstage;
+
+static sbstage stage[SB_STAGE_LINES];
+static uint stage_tail, stage_done, stage_head;
+
+/* Lines moved into storage, kept for scrollback_push() to hand out. */
+static termline *spare[SB_STAGE_BATCH];
+static int spare_count;
+static bool stage_flush;   /* compress lines without waiting for a batch */
+static bool worker_started, worker_running, worker_busy;
+static pthread_mutex_t stage_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+
+static void *
+compress_worker(void *unused(arg))
+{
+  pthread_mutex_lock(&stage_mutex);
+  for (;;) {
+    while (stage_head - stage_done < (stage_flush ? 1 : SB_STAGE_BATCH))
+      pthread_cond_wait(&work_cond, &stage_mutex);
+    uint start = stage_done;
+    uint end = start + min(stage_head - start, SB_STAGE_BATCH);
+    worker_busy = true;
+    pthread_mutex_unlock(&stage_mutex);
+
+    for (uint i = start; i != end; i++) {
+      sbstage *s = &stage[i % SB_STAGE_LINES];
+      s->len = compressline(s->line, &s->data, &s->size);
+    }
+
+    pthread_mutex_lock(&stage_mutex);
+    stage_done = end;
+    worker_busy = false;
+    pthread_cond_broadcast(&done_cond);
+  }
+  return 0;
+}
+
+/* Number of lines that have been moved out of the staging queue. */
+static int
+stored_lines(void)
+{
+  return term.sblines - (stage_head - stage_tail);
+}
+
+static void unstage_all(void);
+
+static uint *
+offset_of(int n)
+{
+  int i = offsets_pos - (term.sbfirst + stored_lines() - n);
+  if (i < 0)
+    i += offsets_len; // Scrollback has wrapped round
+  return &offsets[i];
+}
+
+/* Return the data of stored line n, decompressing its group into s. */
+static uchar *
+read_line(lzstate *s, int n)
+{
+  int g = n / SB_GROUP_LINES;
+  uint offset = *offset_of(n);
+  if (offset & SB_SHARED)
+    return shared[offset & ~SB_SHARED].data;
+  if (g == first_group + group_count)
+    return open_data + offset;
+
+  sbgroup *group = &groups[g - first_group];
+  if (s->group != g) {
+    s->group = g;
+    s->len = s->in_pos = 0;
+    if (s->size < group->raw_size) {
+      s->size = group->raw_size;
+      s->data = renewn(s->data, s->size);
+    }
+  }
+  // The line's data ends where the group's next unshared line starts.
+  uint end = group->raw_size;
+  for (int m = n + 1; m % SB_GROUP_LINES; m++) {
+    uint next = *offset_of(m);
+    if (!(next & SB_SHARED)) {
+      end = next;
+      break;
+    }
+  }
+  lz_decompress(s, group->block->data + group->pos, group->size, end);
+  return s->data + offset;
+}
+
+/*
+ * Return the compressline() data of absolute scrollback line n. This
+ * stays valid until the scrollback is next accessed.
+ */
+uchar *
+scrollback_line(int n)
+{
+  assert(term.sbfirst <= n && n < term.sbfirst + term.sblines);
+  if (n >= term.sbfirst + stored_lines())
+    unstage_all();
+  return read_line(&decoded, n);
+}
+
+/*
+ * Readers have their own decompression state, so that several threads can
+ * read the scrollback at once, as long as it isn't modified meanwhile and
+ * scrollback_flush() has been called first.
+ */
+struct sbreader {
+  lzstate state;
+};
+
+sbreader *
+sbreader_new(void)
+{
+  sbreader *r = new(sbreader);
+  *r = (sbreader){.state = {.group = -1}};
+  return r;
+}
+
+/*
+ * Forget the group decompressed by a reader, as the scrollback may have
+ * changed since it was last used.
+ */
+void
+sbreader_reset(sbreader *r)
+{
+  r->state.group = -1;
+}
+
+void
+sbreader_free(sbreader *r)
+{
+  free(r->state.data);
+  free(r);
+}
+
+/* Return the data of line n, which stays valid until the next call. */
+uchar *
+sbreader_line(sbreader *r, int n)
+{
+  assert(term.sbfirst <= n && n < term.sbfirst + stored_lines());
+  return read_line(&r->state, n);
+}
+
+/*
+ * Stashes hold lines taken off the scrollback while older lines are
+ * rewrapped, until they are taken out again in reverse order. The lines'
+ * data is collected in chunks, each preceded by its length, and full
+ * chunks are compressed into blocks of their own, which are spilled like
+ * the scrollback's blocks. This way, setting aside a long history doesn't
+ * take more memory than the scrollback did.
+ */
+#define SB_STASH_CHUNK (4 * SB_BLOCK_SIZE)
+
+struct sbstash {
+  sbgroup *chunks;     /* compressed chunks, oldest first */
+  int chunk_count, chunks_size;
+  uchar *data;         /* the newest chunk */
+  uint len, size;
+  uint *lines;         /* positions of its lines, while taking them out */
+  int line_count, lines_size;
+};
+
+sbstash *
+sbstash_new(void)
+{
+  sbstash *st = new(sbstash);
+  *st = (sbstash){.chunks = 0};
+  return st;
+}
+
+static void
+seal_chunk(sbstash *st)
+{
+  if (buf_size < (int)lz_bound(st->len)) {
+    buf_size = lz_bound(st->len);
+    buf = renewn(buf, buf_size);
+  }
+  uint size = lz_compress(st->data, st->len, buf);
+  sbblock *block = new(sbblock);
+  *block = (sbblock){
+    .groups = 1, .size = size, .used = size,
+    .data = memcpy(newn(uchar, size), buf, size), .pos = -1
+  };
+  heap_bytes += size;
+  if (cfg.scrollback_memory && heap_bytes > (size_t)cfg.scrollback_memory)
+    spill_block(block);
+
+  if (st->chunk_count == st->chunks_size) {
+    st->chunks_size = st->chunks_size * 2 + 16;
+    st->chunks = renewn(st->chunks, st->chunks_size);
+  }
+  st->chunks[st->chunk_count++] = (sbgroup){
+    .block = block, .pos = 0, .size = size, .raw_size = st->len
+  };
+  st->len = 0;
+}
+
+/* Add a copy of a line's compressline() data. */
+void
+sbstash_push(sbstash *st, uchar *data, int len)
+{
+  assert(!st->line_count);
+  uint n = len;
+  if (st->len && st->len + sizeof n + n > SB_STASH_CHUNK)
+    seal_chunk(st);
+  if (st->size < st->len + sizeof n + n) {
+    st->size = max(st->len + sizeof n + n, SB_STASH_CHUNK);
+    st->data = renewn(st->data, st->size);
+  }
+  memcpy(st->data + st->len, &n, sizeof n);
+  memcpy(st->data + st->len + sizeof n, data, n);
+  st->len += sizeof n + n;
+}
+
+/*
+ * Take out the newest line remaining, or return null if there are none.
+ * The data stays valid until the next call.
+ */
+uchar *
+sbstash_pop(sbstash *st)
+{
+  if (!st->line_count) {
+    if (!st->len) {
+      if (!st->chunk_count)
+        return 0;
+      sbgroup *chunk = &st->chunks[--st->chunk_count];
+      if (st->size < chunk->raw_size) {
+        st->size = chunk->raw_size;
+        st->data = renewn(st->data, st->size);
+      }
+      lzstate s = {.data = st->data};
+      lz_decompress(&s, chunk->block->data, chunk->size, chunk->raw_size);
+      st->len = chunk->raw_size;
+      free_block(chunk->block);
+    }
+    for (uint pos = 0, n; pos < st->len; pos += sizeof n + n) {
+      memcpy(&n, st->data + pos, sizeof n);
+      if (st->line_count == st->lines_size) {
+        st->lines_size = st->lines_size * 2 + 256;
+        st->lines = renewn(st->lines, st->lines_size);
+      }
+      st->lines[st->line_count++] = pos + sizeof n;
+    }
+    st->len = 0;
+  }
+  return st->data + st->lines[--st->line_count];
+}
+
+void
+sbstash_free(sbstash *st)
+{
+  for (int i = 0; i < st->chunk_count; i++)
+    free_block(st->chunks[i].block);
+  free(st->chunks);
+  free(st->data);
+  free(st->lines);
+  free(st);
+}
+
+/* Compress the newest group and store it in a block. */
+static void
+seal_group(void)
+{
+  if (buf_size < (int)lz_bound(open_len)) {
+    buf_size = lz_bound(open_len);
+    buf = renewn(buf, buf_size);
+  }
+  uint size = lz_compress(open_data, open_len, buf);
+
+  sbblock *block = block_count ? blocks[block_count - 1] : 0;
+  if (!block || block->pos >= 0 || block->size - block->used < size) {
+    uint block_size = max(SB_BLOCK_SIZE, size);
+    block = new(sbblock);
+    *block = (sbblock){
+      .size = block_size, .data = newn(uchar, block_size), .pos = -1
+    };
+    heap_bytes += block_size;
+    if (block_count == blocks_size) {
+      blocks_size = blocks_size * 2 + 16;
+      blocks = renewn(blocks, blocks_size);
+    }
+    blocks[block_count++] = block;
+  }
+
+  if (group_count == groups_size) {
+    groups_size = groups_size * 2 + 16;
+    groups = renewn(groups, groups_size);
+  }
+  groups[group_count++] = (sbgroup){
+    .block = block, .pos = block->used, .size = size, .raw_size = open_len
+  };
+  memcpy(block->data + block->used, buf, size);
+  block->used += size;
+  block->groups++;
+  stored_bytes += size;
+  stored_bytes -= open_len;
+  open_len = 0;
+  spill_blocks();
+}
+
+/* Turn the newest sealed group back into the open one. */
+static void
+unseal_group(void)
+{
+  assert(open_len == 0 && group_count > 0);
+  sbgroup *group = &groups[group_count - 1];
+  if (open_size < group->raw_size) {
+    open_size = group->raw_size;
+    open_data = renewn(open_data, open_size);
+  }
+  lzstate s = {.data = open_data};
+  lz_decompress(&s, group->block->data + group->pos, group->size,
+                group->raw_size);
+  open_len = group->raw_size;
+  stored_bytes += open_len;
+  stored_bytes -= group->size;
+
+  sbblock *block = blocks[block_count - 1];
+  // A spilled block keeps its mapped length in 'used', so its groups
+  // no longer end there once the last of them has been unsealed.
+  assert(group->block == block &&
+         (block->pos >= 0 || group->pos + group->size == block->used));
+  if (--block->groups == 0)
+    free_block(blocks[--block_count]);
+  else if (block->pos < 0)
+    block->used -= group->size;
+  if (decoded.group == first_group + group_count - 1)
+    decoded.group = -1;
+  group_count--;
+}
+
+/* Drop sealed groups whose lines have all been thrown away. */
+static void
+drop_groups(void)
+{
+  int n = 0;
+  while (n < group_count &&
+         (first_group + n + 1) * SB_GROUP_LINES <= term.sbfirst) {
+    if (--blocks[0]->groups == 0) {
+      free_block(blocks[0]);
+      block_count--;
+      memmove(blocks, blocks + 1, block_count * sizeof *blocks);
+    }
+    if (decoded.group == first_group + n)
+      decoded.group = -1;
+    rle_bytes -= groups[n].raw_size;
+    stored_bytes -= groups[n].size;
+    n++;
+  }
+  if (n) {
+    group_count -= n;
+    first_group += n;
+    memmove(groups, groups + n, group_count * sizeof *groups);
+  }
+}
+
+static void
+drop_oldest_line(void)
+{
+  sbcache_invalidate(term.sbfirst);
+  release_offset(*offset_of(term.sbfirst));
+  term.sbfirst++;
+  term.sblines--;
+  drop_groups();
+}
+
+/*
+ * Move the selection and the view off lines that have been thrown away
+ * from the top of the scrollback.
+ */
+static void
+clamp_to_scrollback(void)
+{
+  void clamp_pos(pos *p) {
+    if (p->y < -term.sblines)
+      *p = (pos){.y = -term.sblines, .x = 0};
+  }
+  clamp_pos(&term.sel_start);
+  clamp_pos(&term.sel_anchor);
+  clamp_pos(&term.sel_end);
+  if (term.disptop < -term.sblines) {
+    term.disptop = -term.sblines;
+    term_damage_all();
+  }
+}
+
+/*
+ * Throw away the oldest groups while over the byte limit. This is only
+ * done when a new group is started in scrollback_push(), with all lines
+ * stored, so that the number of lines only changes there, and in the same
+ * way whether or not lines are compressed by the worker thread.
+ */
+static void
+apply_byte_limit(void)
+{
+  while (group_count && stored_bytes > (size_t)cfg.scrollback_bytes) {
+    int end = (first_group + 1) * SB_GROUP_LINES;
+    for (int n = term.sbfirst; n < end; n++) {
+      sbcache_invalidate(n);
+      release_offset(*offset_of(n));
+    }
+    term.sblines -= end - term.sbfirst;
+    term.sbfirst = end;
+    term.tempsblines = min(term.tempsblines, term.sblines);
+    drop_groups();
+    clamp_to_scrollback();
+  }
+}
+
+/*
+ * Move the oldest staged line into storage, waiting for it to be
+ * compressed if necessary.
+ */
+static void
+unstage_line(void)
+{
+  assert(stage_tail != stage_head);
+  pthread_mutex_lock(&stage_mutex);
+  while (stage_done == stage_tail) {
+    stage_flush = true;
+    pthread_cond_signal(&work_cond);
+    pthread_cond_wait(&done_cond, &stage_mutex);
+  }
+  stage_flush = false;
+  pthread_mutex_unlock(&stage_mutex);
+
+  sbstage *s = &stage[stage_tail % SB_STAGE_LINES];
+  uchar *data = s->data;
+  int len = s->len;
+  int stored = stored_lines();
+
+  if (stored == offsets_len) {
+    // Need to make space for the new line.
+    if (offsets_len < cfg.scrollback_lines) {
+      // Expand the offsets ring, unwrapping it if the byte limit has
+      // thrown away lines before it was full.
+      int new_len = min(cfg.scrollback_lines, offsets_len * 3 + 1024);
+      uint *new_offsets = newn(uint, new_len);
+      if (offsets_len) {
+        int wrapped = offsets_len - offsets_pos;
+        memcpy(new_offsets, offsets + offsets_pos, wrapped * sizeof *offsets);
+        memcpy(new_offsets + wrapped, offsets, offsets_pos * sizeof *offsets);
+      }
+      free(offsets);
+      offsets = new_offsets;
+      offsets_pos = offsets_len;
+      offsets_len = new_len;
+    }
+    else {
+      // Throw away the oldest line
+      drop_oldest_line();
+      stored--;
+    }
+  }
+  assert(stored < offsets_len);
+  assert(offsets_pos < offsets_len);
+
+  int n = term.sbfirst + stored;
+  uint hash = line_hash(data, len);
+  sbshared *e = find_shared(hash, data, len);
+  if (!e) {
+    // Start sharing the line's data if it repeats a recent line.
+    typeof(*recent) *r = &recent[hash & ((1 << SB_RECENT_BITS) - 1)];
+    int m = r->n - 1;
+    if (m >= term.sbfirst && r->hash == hash && r->len == (uint)len &&
+        !memcmp(scrollback_line(m), data, len))
+      e = add_shared(hash, data, len);
+    else
+      *r = (typeof(*r)){.n = n + 1, .hash = hash, .len = len};
+  }
+
+  if (e) {
+    e->refs++;
+    dedup_lines++;
+    offsets[offsets_pos++] = SB_SHARED | (e - shared);
+  }
+  else {
+    if (open_size < open_len + len) {
+      open_size = max(open_len + len, open_size * 2);
+      open_data = renewn(open_data, open_size);
+    }
+    memcpy(open_data + open_len, data, len);
+    offsets[offsets_pos++] = open_len;
+    open_len += len;
+    stored_bytes += len;
+  }
+  if (offsets_pos == offsets_len)
+    offsets_pos = 0;
+  rle_bytes += len;
+  sbindex_add(n, s->line);
+
+  if (spare_count < SB_STAGE_BATCH)
+    spare[spare_count++] = s->line;
+  else
+    freeline(s->line);
+  s->line = 0;
+  stage_tail++;
+
+  if ((n + 1) % SB_GROUP_LINES == 0) {
+    seal_group();
+    drop_groups();
+  }
+}
+
+static void
+unstage_all(void)
+{
+  sbscan_wait();
+  while (stage_tail != stage_head)
+    unstage_line();
+}
+
+/* Move all staged lines into storage. */
+void
+scrollback_flush(void)
+{
+  unstage_all();
+}
+
+/*
+ * Add a line to the scrollback, which takes ownership of it. The line is
+ * staged for compression by the worker thread, and lines that have been
+ * compressed already are moved into storage. Returns a line of the same
+ * width with undefined contents for the caller to use in its place.
+ */
+termline *
+scrollback_push(termline *line)
+{
+  sbscan_wait();
+  if (!cfg.scrollback_lines)
+    return line;
+
+  // Stored lines get read directly, so fill in a lazily cleared one.
+  if (line->cleared)
+    line = fill_cleared(line);
+
+  pthread_mutex_lock(&stage_mutex);
+  uint done = stage_done;
+  pthread_mutex_unlock(&stage_mutex);
+  while (stage_tail != done)
+    unstage_line();
+
+  if (term.sblines >= cfg.scrollback_lines) {
+    // Throw away the oldest line
+    if (!stored_lines())
+      unstage_line();
+    drop_oldest_line();
+  }
+  if (cfg.scrollback_bytes &&
+      (term.sbfirst + term.sblines) % SB_GROUP_LINES == 0) {
+    unstage_all();
+    apply_byte_limit();
+  }
+  if (stage_head - stage_tail == SB_STAGE_LINES)
+    unstage_line();
+
+  if (!worker_started) {
+    // A worker only helps if it can run alongside the parser.
+    worker_started = true;
+    pthread_t thread;
+    worker_running =
+      sysconf(_SC_NPROCESSORS_ONLN) > 1 &&
+      !pthread_create(&thread, 0, compress_worker, 0);
+    if (worker_running)
+      pthread_detach(thread);
+  }
+
+  sbstage *s = &stage[stage_head % SB_STAGE_LINES];
+  s->line = line;
+  pthread_mutex_lock(&stage_mutex);
+  stage_head++;
+  if (!worker_running) {
+    // Compress the line right here if there's no worker.
+    s->len = compressline(line, &s->data, &s->size);
+    stage_done = stage_head;
+  }
+  else if (stage_head - stage_done >= SB_STAGE_BATCH)
+    pthread_cond_signal(&work_cond);
+  pthread_mutex_unlock(&stage_mutex);
+
+  term.sblines++;
+  if (term.tempsblines < term.sblines)
+    term.tempsblines++;
+
+  // Without a worker, store the line straight away and hand it back.
+  if (!worker_running)
+    unstage_line();
+
+  int cols = line->cols;
+  while (spare_count) {
+    termline *reuse = spare[--spare_count];
+    if (reuse->cols == cols)
+      return reuse;
+    freeline(reuse);
+  }
+  return newline(cols, false);
+}
+
+/*
+ * Return staged line n, which mustn't be modified, or null if it has been
+ * moved into storage already.
+ */
+termline *
+scrollback_staged(int n)
+{
+  int i = n - (term.sbfirst + stored_lines());
+  return i >= 0 ? stage[(stage_tail + i) % SB_STAGE_LINES].line : 0;
+}
+
+/*
+ * Remove the newest line from the scrollback and return it decompressed.
+ */
+termline *
+scrollback_pop(void)
+{
+  assert(term.sblines > 0);
+  sbscan_wait();
+  int n = term.sbfirst + term.sblines - 1;
+  sbcache_invalidate(n);
+
+  termline *line;
+  if (stage_head != stage_tail) {
+    // Take the line back from the staging queue.
+    pthread_mutex_lock(&stage_mutex);
+    while (worker_busy)
+      pthread_cond_wait(&done_cond, &stage_mutex);
+    stage_head--;
+    if (stage_done - stage_tail > stage_head - stage_tail)
+      stage_done = stage_head;
+    pthread_mutex_unlock(&stage_mutex);
+    sbstage *s = &stage[stage_head % SB_STAGE_LINES];
+    line = s->line;
+    s->line = 0;
+  }
+  else {
+    if ((n + 1) % SB_GROUP_LINES == 0)
+      unseal_group();
+    uint offset = *offset_of(n);
+    if (offset & SB_SHARED) {
+      line = decompressline(shared[offset & ~SB_SHARED].data, null);
+      release_offset(offset);
+    }
+    else {
+      uint len = open_len - offset;
+      line = decompressline(open_data + offset, null);
+      uint hash = line_hash(open_data + offset, len);
+      typeof(*recent) *r = &recent[hash & ((1 << SB_RECENT_BITS) - 1)];
+      if (r->n == n + 1)
+        r->n = 0;
+      rle_bytes -= len;
+      stored_bytes -= len;
+      open_len = offset;
+    }
+    if (offsets_pos == 0)
+      offsets_pos = offsets_len;
+    offsets_pos--;
+    sbindex_remove(n);
+  }
+  line->temporary = false;
+
+  term.sblines--;
+  if (term.tempsblines)
+    term.tempsblines--;
+  return line;
+}
+
+void
+scrollback_clear(void)
+{
+  sbscan_wait();
+  pthread_mutex_lock(&stage_mutex);
+  while (worker_busy)
+    pthread_cond_wait(&done_cond, &stage_mutex);
+  for (; stage_tail != stage_head; stage_tail++) {
+    sbstage *s = &stage[stage_tail % SB_STAGE_LINES];
+    freeline(s->line);
+    s->line = 0;
+  }
+  stage_done = stage_head;
+  pthread_mutex_unlock(&stage_mutex);
+
+  sbcache_clear();
+  sbindex_clear();
+  for (int i = 0; i < block_count; i++)
+    free_block(blocks[i]);
+  free(blocks);
+  free(groups);
+  free(offsets);
+  blocks = 0;
+  groups = 0;
+  offsets = 0;
+  block_count = blocks_size = 0;
+  group_count = groups_size = first_group = 0;
+  offsets_len = offsets_pos = 0;
+  open_len = 0;
+  if (spill_fd >= 0) {
+    close(spill_fd);
+    spill_fd = -1;
+  }
+  spill_len = 0;
+  free_slot_count = 0;
+  for (int i = 0; i < shared_count; i++) {
+    if (shared[i].refs)
+      free(shared[i].data);
+  }
+  free(shared);
+  free(buckets);
+  shared = 0;
+  buckets = 0;
+  shared_count = shared_size = 0;
+  shared_free = -1;
+  bucket_mask = 0;
+  dedup_lines = 0;
+  memset(recent, 0, sizeof recent);
+  rle_bytes = stored_bytes = 0;
+  decoded.group = -1;
+  term.sblines = term.sbfirst = term.tempsblines = term.sbreflow = 0;
+}
+
+void
+scrollback_stats(sbstats *stats)
+{
+  unstage_all();
+  *stats = (sbstats){
+    .lines = term.sblines,
+    .rle_bytes = rle_bytes,
+    .stored_bytes = stored_bytes,
+    .spilled_bytes = spilled_bytes,
+    .dedup_lines = dedup_lines
+  };
+}
@@ -0,0 +1,724 @@
+// termsearch.c (part of mintty)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+/*
+ * Searching the scrollback and screen for text.
+ *
+ * Scrollback lines are indexed as they are moved into storage. The
+ * history is divided into segments of SEARCH_SEG_LINES lines, and the
+ * case-folded character trigrams of each line are hashed into one of
+ * 1 << SEARCH_BUCKET_BITS buckets. Each bucket has a posting list of the
+ * segments in which one of its trigrams occurs. A query intersects the
+ * posting lists of the trigrams in the search text, which leaves only a few
+ * candidate segments whose lines need to be decompressed and checked.
+ * Hash collisions and lines that have been popped again merely add
+ * candidates.
+ *
+ * Posting lists hold the differences between successive segment numbers
+ * as variable-length integers. Segments whose lines have all been thrown
+ * away are trimmed from the front of a list whenever it is added to.
+ *
+ * Staged lines and the screen aren't indexed, so they are always checked
+ * directly. Matches don't extend across line breaks, not even wrapped ones.
+ *
+ * Regular expressions can't make use of the index, so they are matched
+ * against every line. The scrollback is split into chunks of
+ * SCAN_CHUNK_LINES lines, which a pool of worker threads take in turn,
+ * while the calling thread carries on. Each thread decodes lines into its
+ * own termline and converts them to UTF-8 for regexec(). Matches are
+ * collected per chunk, so that they can be put together in order once the
+ * search is finished. Until then, the scrollback mustn't change, so
+ * termsb.c calls sbscan_wait() before modifying it.
+ */
+
+#include "termpriv.h"
+
+#include "charset.h"
+
+#include <stdint.h>
+#include <wctype.h>
+#include <regex.h>
+#include <pthread.h>
+
+#define SEARCH_SEG_LINES 256
+#define SEARCH_BUCKET_BITS 16
+
+typedef struct {
+  uchar *data;  /* zigzag-encoded segment number deltas, as 7-bit varints */
+  uint start;   /* position of the oldest entry */
+  uint len, size;
+  int first;    /* segment number of the oldest entry */
+  int last;     /* segment number of the newest entry plus one, or 0 */
+} posting;
+
+static posting *postings;
+static int indexed_end;  /* lines from this one onwards aren't indexed */
+
+/* Buckets added to already for segment seen_seg, which saves most
+ * trips to the much larger postings array. */
+static uint seen[1 << SEARCH_BUCKET_BITS >> 5];
+static int seen_seg = -1;
+
+static inline wchar
+fold(wchar c)
+{
+  if (c < 0x80)
+    return c >= 'A' && c <= 'Z' ? c + 0x20 : c;
+  return towlower(c);
+}
+
+/* Trigrams are packed into 16 bits per character, which only matters for
+ * the distribution of the hash. */
+#define TRIGRAM_MASK 0xFFFFFFFFFFFFull
+#define SPACES 0x002000200020ull
+
+static inline uint64_t
+add_char(uint64_t trigram, wchar c)
+{ return (trigram << 16 ^ c) & TRIGRAM_MASK; }
+
+static inline uint
+trigram_bucket(uint64_t trigram)
+{ return trigram * 0x9E3779B97F4A7C15ull >> (64 - SEARCH_BUCKET_BITS); }
+
+static int
+get_delta(const uchar *data, uint *pos)
+{
+  uint v = 0;
+  for (int shift = 0;; shift += 7) {
+    uchar b = data[(*pos)++];
+    v |= (uint)(b & 0x7F) << shift;
+    if (!(b & 0x80))
+      return (int)(v >> 1) ^ -(int)(v & 1);
+  }
+}
+
+/* Drop entries for segments that are older than min_seg. */
+static void
+trim_posting(posting *p, int min_seg)
+{
+  while (p->start < p->len && p->first < min_seg) {
+    get_delta(p->data, &p->start);
+    if (p->start < p->len) {
+      uint pos = p->start;
+      p->first += get_delta(p->data, &pos);
+    }
+  }
+  if (p->start == p->len)
+    p->start = p->len = p->last = 0;
+  else if (p->start > p->len / 2) {
+    p->len -= p->start;
+    memmove(p->data, p->data + p->start, p->len);
+    p->start = 0;
+  }
+}
+
+static void
+add_posting(posting *p, int seg, int min_seg)
+{
+  if (p->last == seg + 1)
+    return;
+  trim_posting(p, min_seg);
+  int delta = 0;
+  if (p->start == p->len)
+    p->first = seg;
+  else
+    delta = seg - (p->last - 1);  // negative after lines were popped
+  if (p->size < p->len + 5) {
+    p->size = p->size * 2 + 8;
+    p->data = renewn(p->data, p->size);
+  }
+  uint v = (uint)delta << 1 ^ (uint)(delta >> 31);
+  while (v >= 0x80) {
+    p->data[p->len++] = v | 0x80;
+    v >>= 7;
+  }
+  p->data[p->len++] = v;
+  p->last = seg + 1;
+}
+
+/* Index absolute scrollback line n, which has just been stored. */
+void
+sbindex_add(int n, termline *line)
+{
+  if (!postings)
+    postings = newn(posting, 1 << SEARCH_BUCKET_BITS);
+  int seg = n / SEARCH_SEG_LINES;
+  int min_seg = term.sbfirst / SEARCH_SEG_LINES;
+  if (seg != seen_seg) {
+    memset(seen, 0, sizeof seen);
+    seen_seg = seg;
+  }
+  // Trigrams that are all spaces are skipped, so trailing spaces are too.
+  int cols = line->cols;
+  while (cols && cell_chr(line, cols - 1) == ' ')
+    cols--;
+  cols = min(cols + 2, line->cols);
+
+  uint64_t trigram = 0;
+  int k = 0;
+  for (int x = 0; x < cols; x++) {
+    wchar c = cell_chr(line, x);
+    if (c == UCSWIDE)
+      continue;
+    trigram = add_char(trigram, fold(c));
+    if (++k >= 3 && trigram != SPACES) {
+      uint i = trigram_bucket(trigram);
+      if (!(seen[i >> 5] & 1u << (i & 31))) {
+        seen[i >> 5] |= 1u << (i & 31);
+        add_posting(&postings[i], seg, min_seg);
+      }
+    }
+  }
+  indexed_end = n + 1;
+}
+
+/* Absolute scrollback line n has been popped off again. */
+void
+sbindex_remove(int n)
+{
+  indexed_end = min(indexed_end, n);
+}
+
+static void scan_cleared(void);
+
+void
+sbindex_clear(void)
+{
+  if (postings) {
+    for (int i = 0; i < 1 << SEARCH_BUCKET_BITS; i++)
+      free(postings[i].data);
+    free(postings);
+    postings = 0;
+  }
+  indexed_end = 0;
+  seen_seg = -1;
+  scan_cleared();
+}
+
+static int
+cmp_int(const void *a, const void *b)
+{
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+/*
+ * Return the sorted list of segments that may contain the (folded) text,
+ * or null if the text has no trigrams to go by.
+ */
+static int *
+candidate_segs(const wchar *text, int len, int *count_p)
+{
+  int min_seg = term.sbfirst / SEARCH_SEG_LINES;
+  int *segs = 0, count = 0;
+  int *list = 0, list_size = 0;
+  bool any = false;
+  uint64_t trigram = 0;
+  for (int i = 0; i < len; i++) {
+    trigram = add_char(trigram, text[i]);
+    if (i < 2 || trigram == SPACES)
+      continue;
+    any = true;
+    if (!postings) {
+      count = 0;
+      break;
+    }
+    posting *p = &postings[trigram_bucket(trigram)];
+
+    // Decode the posting list, dropping stale and repeated entries.
+    int n = 0;
+    int seg = p->first;
+    for (uint pos = p->start; pos < p->len;) {
+      if (pos > p->start)
+        seg += get_delta(p->data, &pos);
+      else
+        get_delta(p->data, &pos);
+      if (seg < min_seg)
+        continue;
+      if (n == list_size) {
+        list_size = list_size * 2 + 256;
+        list = renewn(list, list_size);
+      }
+      list[n++] = seg;
+    }
+    qsort(list, n, sizeof *list, cmp_int);
+
+    if (!segs) {
+      segs = newn(int, n + 1);
+      for (int j = 0; j < n; j++) {
+        if (!count || segs[count - 1] != list[j])
+          segs[count++] = list[j];
+      }
+    }
+    else {
+      int m = 0;
+      for (int j = 0, k = 0; j < count && k < n;) {
+        if (segs[j] < list[k])
+          j++;
+        else if (segs[j] > list[k])
+          k++;
+        else {
+          segs[m++] = segs[j++];
+          while (k < n && list[k] == segs[m - 1])
+            k++;
+        }
+      }
+      count = m;
+    }
+    if (!count)
+      break;
+  }
+  free(list);
+  if (any && !segs)
+    segs = newn(int, 1);
+  *count_p = count;
+  return segs;
+}
+
+/*
+ * Look for the text in a line, which has been folded already unless
+ * match_case is set. Of the matches on row y, pick the
+ * last one before pos from when searching backwards, or the first one
+ * after it otherwise.
+ */
+static bool
+match_line(termline *line, int y, const wchar *text, int len,
+           bool match_case, bool backward, pos from,
+           pos *start_p, pos *end_p)
+{
+  int cols = min(line->cols, term.cols);
+  wchar chars[cols];
+  int xs[cols + 1];
+  int count = 0;
+  for (int x = 0; x < cols; x++) {
+    wchar c = cell_chr(line, x);
+    if (c != UCSWIDE) {
+      chars[count] = match_case ? c : fold(c);
+      xs[count++] = x;
+    }
+  }
+  xs[count] = cols;
+
+  bool found = false;
+  for (int i = 0; i + len <= count; i++) {
+    pos p = {.y = y, .x = xs[i]};
+    if (backward ? !poslt(p, from) : !poslt(from, p)) {
+      if (backward)
+        break;
+      continue;
+    }
+    if (memcmp(chars + i, text, len * sizeof *text))
+      continue;
+    *start_p = p;
+    *end_p = (pos){.y = y, .x = xs[i + len]};
+    found = true;
+    if (!backward)
+      break;
+  }
+  return found;
+}
+
+/*
+ * Search the scrollback and screen for text, starting from *start_p and
+ * going backwards or forwards. The start of the match must be before or
+ * after *start_p respectively, so that repeated calls step from match to
+ * match. On success, *start_p and *end_p are set to the match, in the form
+ * used for term.sel_start and term.sel_end.
+ */
+bool
+term_search(const wchar *text, int len, bool match_case, bool backward,
+            pos *start_p, pos *end_p)
+{
+  if (len <= 0)
+    return false;
+
+  scrollback_reflow(term.sblines, term.cols);
+
+  wchar *folded = newn(wchar, len);
+  for (int i = 0; i < len; i++)
+    folded[i] = fold(text[i]);
+
+  int count;
+  int *segs = candidate_segs(folded, len, &count);
+  if (!match_case)
+    text = folded;
+
+  int top = -sblines();
+  int sbend = term.sbfirst + term.sblines;
+  pos from = *start_p;
+  int step = backward ? -1 : 1;
+  bool found = false;
+  for (int y = max(top, min(term.rows - 1, from.y));
+       !found && y >= top && y < term.rows; y += step) {
+    termline *line;
+    if (y < 0) {
+      int n = sbend + y;
+      if (segs && n < indexed_end &&
+          !bsearch(&(int){n / SEARCH_SEG_LINES}, segs, count, sizeof *segs,
+                   cmp_int)) {
+        // Skip the indexed lines of this segment.
+        int seg_start = n - n % SEARCH_SEG_LINES;
+        if (backward)
+          y = max(seg_start, term.sbfirst) - sbend;
+        else
+          y = min(seg_start + SEARCH_SEG_LINES, indexed_end) - sbend - 1;
+        continue;
+      }
+      termline *staged = scrollback_staged(n);
+      line = staged ?: decompressline(scrollback_line(n), null);
+      found = match_line(line, y, text, len, match_case, backward, from,
+                         start_p, end_p);
+      if (!staged)
+        freeline(line);
+    }
+    else {
+      line = fetch_line(y);
+      found = match_line(line, y, text, len, match_case, backward, from,
+                         start_p, end_p);
+    }
+  }
+
+  free(segs);
+  free(folded);
+  return found;
+}
+
+
+#define SCAN_CHUNK_LINES 4096
+#define SCAN_MAX_THREADS 16
+
+/*
+ * Each scanner has its own copy of the regular expression, as glibc's
+ * regexec() locks the pattern while matching.
+ */
+typedef struct {
+  regex_t regex;
+  sbreader *reader;
+  termline *line;   /* reused for each line decoded */
+  char *text;       /* the line's characters in UTF-8 */
+  int *text_cols;   /* column of each byte of text */
+  int text_size;
+} scanner;
+
+typedef struct {
+  search_match *matches;
+  int count, size;
+} scan_chunk;
+
+static struct {
+  string pattern;       /* regular expression and its regcomp() flags */
+  int cflags;
+  int first, end;       /* scrollback lines to scan */
+  int cols;             /* terminal width when the search was started */
+  int origin;           /* absolute line number of screen row 0 then */
+  scan_chunk *chunks;   /* matches per chunk, with the screen's last */
+  int chunk_count, next_chunk;
+  int active;           /* threads still scanning */
+  uint seq;             /* number of the current job */
+} job;
+
+static pthread_mutex_t scan_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t scan_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t scan_done_cond = PTHREAD_COND_INITIALIZER;
+static int scan_threads = -1;  /* worker threads, or -1 if not started */
+static bool scan_running;      /* the scrollback may still be being read */
+static scanner main_scanner;
+
+/*
+ * The scrollback is being cleared, which starts its line numbers from 0
+ * again, so matches that haven't been collected yet need moving along.
+ */
+static void
+scan_cleared(void)
+{
+  job.origin -= term.sbfirst + term.sblines;
+}
+
+static void
+add_text(scanner *sc, int *len_p, xchar c, int x)
+{
+  int len = *len_p;
+  if (sc->text_size < len + 5) {
+    sc->text_size = sc->text_size * 2 + 256;
+    sc->text = renewn(sc->text, sc->text_size);
+    sc->text_cols = renewn(sc->text_cols, sc->text_size);
+  }
+  char *t = sc->text + len;
+  if (c < 0x80)
+    *t++ = c;
+  else if (c < 0x800) {
+    *t++ = 0xC0 | c >> 6;
+    *t++ = 0x80 | (c & 0x3F);
+  }
+  else if (c < 0x10000) {
+    *t++ = 0xE0 | c >> 12;
+    *t++ = 0x80 | (c >> 6 & 0x3F);
+    *t++ = 0x80 | (c & 0x3F);
+  }
+  else {
+    *t++ = 0xF0 | c >> 18;
+    *t++ = 0x80 | (c >> 12 & 0x3F);
+    *t++ = 0x80 | (c >> 6 & 0x3F);
+    *t++ = 0x80 | (c & 0x3F);
+  }
+  for (; len < t - sc->text; len++)
+    sc->text_cols[len] = x;
+  *len_p = len;
+}
+
+/*
+ * Convert a line to UTF-8, including combining characters, and record the
+ * column each byte came from.
+ */
+static int
+line_text(scanner *sc, termline *line, int cols)
+{
+  int len = 0;
+  for (int x = 0; x < cols; x++) {
+    if (cell_chr(line, x) == UCSWIDE)
+      continue;
+    for (int c = x;;) {
+      xchar xc = cell_chr(line, c);
+      if (is_high_surrogate(xc) && cell_cc(line, c) &&
+          is_low_surrogate(cell_chr(line, c + cell_cc(line, c)))) {
+        c += cell_cc(line, c);
+        xc = combine_surrogates(xc, cell_chr(line, c));
+      }
+      add_text(sc, &len, xc ?: ' ', x);
+      if (!cell_cc(line, c))
+        break;
+      c += cell_cc(line, c);
+    }
+  }
+  add_text(sc, &len, 0, cols);
+  return len - 1;
+}
+
+static void
+scan_line(scanner *sc, termline *line, int y, scan_chunk *chunk)
+{
+  int cols = min(line->cols, job.cols);
+  int len = line_text(sc, line, cols);
+  regmatch_t m;
+  for (int pos = 0; pos < len; pos = m.rm_eo) {
+    m = (regmatch_t){.rm_so = pos, .rm_eo = len};
+    if (regexec(&sc->regex, sc->text, 1, &m,
+                REG_STARTEND | (pos ? REG_NOTBOL : 0)))
+      break;
+    if (m.rm_eo == m.rm_so) {
+      // Skip empty matches, moving on to the next character.
+      do
+        m.rm_eo++;
+      while (m.rm_eo < len && (sc->text[m.rm_eo] & 0xC0) == 0x80);
+      continue;
+    }
+    if (chunk->count == chunk->size) {
+      chunk->size = chunk->size * 2 + 16;
+      chunk->matches = renewn(chunk->matches, chunk->size);
+    }
+    chunk->matches[chunk->count++] = (search_match){
+      .start = {.y = y, .x = sc->text_cols[m.rm_so]},
+      .end = {.y = y, .x = sc->text_cols[m.rm_eo]}
+    };
+  }
+}
+
+/* Take chunks of the current job until there are none left. */
+static void
+scan_chunks(scanner *sc)
+{
+  sbreader_reset(sc->reader);
+  for (;;) {
+    pthread_mutex_lock(&scan_mutex);
+    int i = job.next_chunk < job.chunk_count ? job.next_chunk++ : -1;
+    pthread_mutex_unlock(&scan_mutex);
+    if (i < 0)
+      break;
+    int start = max(job.first, (job.first / SCAN_CHUNK_LINES + i) *
+                               SCAN_CHUNK_LINES);
+    int end = min(job.end, start - start % SCAN_CHUNK_LINES +
+                           SCAN_CHUNK_LINES);
+    for (int n = start; n < end; n++) {
+      decompressline_into(sbreader_line(sc->reader, n), sc->line);
+      scan_line(sc, sc->line, n - job.end, &job.chunks[i]);
+    }
+  }
+}
+
+static void
+init_scanner(scanner *sc)
+{
+  if (!sc->reader) {
+    sc->reader = sbreader_new();
+    sc->line = newline(1, false);
+  }
+}
+
+static void *
+scan_worker(void *unused(arg))
+{
+  scanner sc = {.reader = 0};
+  init_scanner(&sc);
+  uint seq = 0;
+  pthread_mutex_lock(&scan_mutex);
+  for (;;) {
+    while (job.seq == seq)
+      pthread_cond_wait(&scan_cond, &scan_mutex);
+    seq = job.seq;
+    pthread_mutex_unlock(&scan_mutex);
+
+   /* Should compiling fail, the other threads take this one's share. */
+    if (!regcomp(&sc.regex, job.pattern, job.cflags)) {
+      scan_chunks(&sc);
+      regfree(&sc.regex);
+    }
+
+    pthread_mutex_lock(&scan_mutex);
+    if (!--job.active)
+      pthread_cond_signal(&scan_done_cond);
+  }
+  return 0;
+}
+
+static void
+start_scan_threads(void)
+{
+  if (scan_threads >= 0)
+    return;
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  scan_threads = 0;
+  while (scan_threads < max(1, min(cpus, SCAN_MAX_THREADS))) {
+    pthread_t thread;
+    if (pthread_create(&thread, 0, scan_worker, 0))
+      break;
+    pthread_detach(thread);
+    scan_threads++;
+  }
+}
+
+/*
+ * Wait for the workers to finish reading the scrollback, so that it can be
+ * modified. Any chunks they couldn't take on are scanned here, while the
+ * scrollback is still the same.
+ */
+void
+sbscan_wait(void)
+{
+  if (!scan_running)
+    return;
+  pthread_mutex_lock(&scan_mutex);
+  while (job.active)
+    pthread_cond_wait(&scan_done_cond, &scan_mutex);
+  pthread_mutex_unlock(&scan_mutex);
+  scan_chunks(&main_scanner);
+  scan_running = false;
+}
+
+static void
+free_job(void)
+{
+  if (!job.chunks)
+    return;
+  regfree(&main_scanner.regex);
+  delete(job.pattern);
+  for (int i = 0; i <= job.chunk_count; i++)
+    free(job.chunks[i].matches);
+  free(job.chunks);
+  job.chunks = 0;
+}
+
+/*
+ * Start looking for matches for an extended regular expression in UTF-8 in
+ * the scrollback and screen. The screen is scanned straight away, whereas
+ * the scrollback is left to the worker threads. Until they have finished,
+ * which term_search_regex_done() tells, anything that modifies the
+ * scrollback waits for them. Returns -1 if the expression is invalid.
+ */
+int
+term_search_regex_start(string pattern, bool match_case)
+{
+  sbscan_wait();
+  free_job();
+
+  int cflags = REG_EXTENDED | REG_NEWLINE | (match_case ? 0 : REG_ICASE);
+  if (regcomp(&main_scanner.regex, pattern, cflags))
+    return -1;
+
+  scrollback_reflow(term.sblines, term.cols);
+  scrollback_flush();
+  start_scan_threads();
+  init_scanner(&main_scanner);
+
+  int lines = sblines();
+  job.pattern = strdup(pattern);
+  job.cflags = cflags;
+  job.end = job.origin = term.sbfirst + term.sblines;
+  job.first = job.end - lines;
+  job.cols = term.cols;
+  job.chunk_count =
+    lines ? (job.end - 1) / SCAN_CHUNK_LINES - job.first / SCAN_CHUNK_LINES + 1
+          : 0;
+  job.chunks = newn(scan_chunk, job.chunk_count + 1);
+  job.next_chunk = 0;
+  if (job.chunk_count) {
+    scan_running = true;
+    pthread_mutex_lock(&scan_mutex);
+    job.active = scan_threads;
+    job.seq++;
+    pthread_cond_broadcast(&scan_cond);
+    pthread_mutex_unlock(&scan_mutex);
+  }
+
+  // The screen goes into an extra chunk at the end.
+  scan_chunk *screen = &job.chunks[job.chunk_count];
+  for (int y = 0; y < term.rows; y++)
+    scan_line(&main_scanner, fetch_line(y), y, screen);
+  return 0;
+}
+
+/* Check whether the workers have finished with the scrollback. */
+bool
+term_search_regex_done(void)
+{
+  pthread_mutex_lock(&scan_mutex);
+  bool done = !job.active;
+  pthread_mutex_unlock(&scan_mutex);
+  return done;
+}
+
+/*
+ * Collect the matches of the search started by term_search_regex_start(),
+ * waiting for it to finish if necessary. Returns the number of matches,
+ * with the matches in order in a newly allocated array at *matches_p.
+ * Matches follow the lines that have scrolled since the search started,
+ * and those on lines that have been thrown away are dropped.
+ */
+int
+term_search_regex_finish(search_match **matches_p)
+{
+  assert(job.chunks);
+  sbscan_wait();
+
+  int shift = job.origin - (term.sbfirst + term.sblines);
+  int top = -sblines();
+  int count = 0;
+  for (int i = 0; i <= job.chunk_count; i++)
+    count += job.chunks[i].count;
+  search_match *matches = newn(search_match, count + 1);
+  count = 0;
+  for (int i = 0; i <= job.chunk_count; i++) {
+    scan_chunk *c = &job.chunks[i];
+    for (int j = 0; j < c->count; j++) {
+      search_match m = c->matches[j];
+      m.start.y += shift;
+      m.end.y += shift;
+      if (m.start.y >= top && m.start.y < term.rows && m.start.x < term.cols) {
+        m.end.x = min(m.end.x, term.cols);
+        matches[count++] = m;
+      }
+    }
+  }
+  free_job();
+  *matches_p = matches;
+  return count;
+}
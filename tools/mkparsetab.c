@@ -0,0 +1,202 @@
+// mkparsetab.c (part of mintty)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+/*
+ * Generates the state transition table for the escape sequence parser in
+ * termout.c, along the lines of the DEC ANSI parser model by Paul Williams
+ * (http://vt100.net/emu/dec_ansi_parser).
+ *
+ * Each entry combines the action to be taken for an input byte in a given
+ * state with the state to go to next, as `action | state << 4'. The table
+ * is written out symbolically, using the state names from term.h and the
+ * action names from termout.c, so that there is nothing to keep in sync
+ * other than the names.
+ *
+ * To add a state, add it to the state enum in term.h and to states[] here,
+ * and describe its transitions in main().
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+static const char *states[] = {
+  "NORMAL", "ESCAPE", "ESC_INTERMEDIATE", "CSI_ARGS",
+  "OSC_START", "OSC_NUM", "OSC_PALETTE", "CMD_STRING", "CMD_ESCAPE",
+  "DCS_STRING", "IGNORE_STRING", "SOS_STRING"
+};
+
+enum {
+  NORMAL, ESCAPE, ESC_INTERMEDIATE, CSI_ARGS,
+  OSC_START, OSC_NUM, OSC_PALETTE, CMD_STRING, CMD_ESCAPE,
+  DCS_STRING, IGNORE_STRING, SOS_STRING,
+  STATE_NUM
+};
+
+static const char *actions[] = {
+  "A_PRINT", "A_EXECUTE", "A_IGNORE", "A_COLLECT", "A_ESC_DISPATCH",
+  "A_CSI_ENTER", "A_CSI_PARAM", "A_CSI_DISPATCH",
+  "A_OSC_ENTER", "A_OSC_NUM", "A_OSC_PALETTE_RESET", "A_OSC_PALETTE_PUT",
+  "A_REPROCESS", "A_CMD_PUT", "A_CMD_DISPATCH", "A_DCS_ENTER"
+};
+
+enum {
+  A_PRINT, A_EXECUTE, A_IGNORE, A_COLLECT, A_ESC_DISPATCH,
+  A_CSI_ENTER, A_CSI_PARAM, A_CSI_DISPATCH,
+  A_OSC_ENTER, A_OSC_NUM, A_OSC_PALETTE_RESET, A_OSC_PALETTE_PUT,
+  A_REPROCESS, A_CMD_PUT, A_CMD_DISPATCH, A_DCS_ENTER,
+  ACTION_NUM
+};
+
+static struct { unsigned char action, next; } table[STATE_NUM][256];
+
+static void
+set(int state, int from, int to, int action, int next)
+{
+  for (int c = from; c <= to; c++) {
+    table[state][c].action = action;
+    table[state][c].next = next;
+  }
+}
+
+static void
+set1(int state, int c, int action, int next)
+{
+  set(state, c, c, action, next);
+}
+
+/*
+ * Control characters within escape and control sequences are executed
+ * without leaving the sequence, except that ESC starts a new one, and
+ * CAN and SUB cancel it.
+ */
+static void
+set_controls(int state)
+{
+  set(state, 0x00, 0x1F, A_EXECUTE, state);
+  set1(state, 0x18, A_IGNORE, NORMAL);
+  set1(state, 0x1A, A_IGNORE, NORMAL);
+  set1(state, 0x1B, A_EXECUTE, ESCAPE);
+}
+
+static void
+set_escape(int state)
+{
+  set_controls(state);
+  set(state, 0x20, 0x2F, A_COLLECT, ESC_INTERMEDIATE);
+  set(state, 0x30, 0x7E, A_ESC_DISPATCH, NORMAL);
+  set1(state, '[', A_CSI_ENTER, CSI_ARGS);
+  set1(state, ']', A_OSC_ENTER, OSC_START);
+  set1(state, 'P', A_DCS_ENTER, DCS_STRING);
+  set1(state, 'X', A_IGNORE, SOS_STRING);
+  set1(state, '^', A_IGNORE, SOS_STRING);
+  set1(state, '_', A_IGNORE, SOS_STRING);
+  set1(state, 0x7F, A_IGNORE, state);
+  set(state, 0x80, 0xFF, A_IGNORE, NORMAL);
+}
+
+int
+main(void)
+{
+  // Text and control characters are dealt with by the A_PRINT action,
+  // as their interpretation depends on the character set.
+  set(NORMAL, 0x00, 0xFF, A_PRINT, NORMAL);
+
+  set_escape(ESCAPE);
+
+  set_controls(ESC_INTERMEDIATE);
+  set(ESC_INTERMEDIATE, 0x20, 0x2F, A_COLLECT, ESC_INTERMEDIATE);
+  set(ESC_INTERMEDIATE, 0x30, 0x7E, A_ESC_DISPATCH, NORMAL);
+  set1(ESC_INTERMEDIATE, 0x7F, A_IGNORE, ESC_INTERMEDIATE);
+  set(ESC_INTERMEDIATE, 0x80, 0xFF, A_IGNORE, NORMAL);
+
+  // Private parameter markers and intermediates are both collected, into
+  // term.esc_mod.
+  set_controls(CSI_ARGS);
+  set(CSI_ARGS, 0x20, 0x3F, A_COLLECT, CSI_ARGS);
+  set(CSI_ARGS, '0', '9', A_CSI_PARAM, CSI_ARGS);
+  set1(CSI_ARGS, ';', A_CSI_PARAM, CSI_ARGS);
+  set(CSI_ARGS, 0x40, 0x7E, A_CSI_DISPATCH, NORMAL);
+  set1(CSI_ARGS, 0x7F, A_IGNORE, CSI_ARGS);
+  set(CSI_ARGS, 0x80, 0xFF, A_IGNORE, NORMAL);
+
+  // OSC command number, or one of the Linux palette sequences.
+  set(OSC_START, 0x00, 0xFF, A_IGNORE, IGNORE_STRING);
+  set1(OSC_START, 'P', A_IGNORE, OSC_PALETTE);
+  set1(OSC_START, 'R', A_OSC_PALETTE_RESET, NORMAL);
+  set(OSC_START, '0', '9', A_OSC_NUM, OSC_NUM);
+  set1(OSC_START, ';', A_IGNORE, CMD_STRING);
+  set1(OSC_START, '\a', A_IGNORE, NORMAL);
+  set1(OSC_START, '\n', A_IGNORE, NORMAL);
+  set1(OSC_START, '\r', A_IGNORE, NORMAL);
+  set1(OSC_START, 0x18, A_IGNORE, NORMAL);
+  set1(OSC_START, 0x1A, A_IGNORE, NORMAL);
+  set1(OSC_START, 0x1B, A_EXECUTE, ESCAPE);
+
+  set(OSC_NUM, 0x00, 0xFF, A_IGNORE, IGNORE_STRING);
+  set(OSC_NUM, '0', '9', A_OSC_NUM, OSC_NUM);
+  set1(OSC_NUM, ';', A_IGNORE, CMD_STRING);
+  set1(OSC_NUM, '\a', A_IGNORE, NORMAL);
+  set1(OSC_NUM, '\n', A_IGNORE, NORMAL);
+  set1(OSC_NUM, '\r', A_IGNORE, NORMAL);
+  set1(OSC_NUM, 0x18, A_IGNORE, NORMAL);
+  set1(OSC_NUM, 0x1A, A_IGNORE, NORMAL);
+  set1(OSC_NUM, 0x1B, A_EXECUTE, ESCAPE);
+
+  // The Linux palette sequence ends after seven hex digits. Anything else
+  // ends it early, and is processed normally unless it's a BEL.
+  set(OSC_PALETTE, 0x00, 0xFF, A_REPROCESS, NORMAL);
+  set(OSC_PALETTE, '0', '9', A_OSC_PALETTE_PUT, OSC_PALETTE);
+  set(OSC_PALETTE, 'A', 'F', A_OSC_PALETTE_PUT, OSC_PALETTE);
+  set(OSC_PALETTE, 'a', 'f', A_OSC_PALETTE_PUT, OSC_PALETTE);
+  set1(OSC_PALETTE, '\a', A_IGNORE, NORMAL);
+
+  // OSC string, terminated by BEL or ST, and cancelled by CR or LF.
+  set(CMD_STRING, 0x00, 0xFF, A_CMD_PUT, CMD_STRING);
+  set1(CMD_STRING, '\a', A_CMD_DISPATCH, NORMAL);
+  set1(CMD_STRING, '\n', A_IGNORE, NORMAL);
+  set1(CMD_STRING, '\r', A_IGNORE, NORMAL);
+  set1(CMD_STRING, 0x18, A_IGNORE, NORMAL);
+  set1(CMD_STRING, 0x1A, A_IGNORE, NORMAL);
+  set1(CMD_STRING, 0x1B, A_IGNORE, CMD_ESCAPE);
+
+  // ESC within an OSC or DCS string: either the start of ST, or the
+  // string is abandoned and the escape sequence is processed.
+  set_escape(CMD_ESCAPE);
+  set1(CMD_ESCAPE, '\\', A_CMD_DISPATCH, NORMAL);
+
+  // DCS string, terminated by ST only. Other control characters are
+  // ignored.
+  set(DCS_STRING, 0x00, 0x1F, A_IGNORE, DCS_STRING);
+  set(DCS_STRING, 0x20, 0xFF, A_CMD_PUT, DCS_STRING);
+  set1(DCS_STRING, 0x18, A_IGNORE, NORMAL);
+  set1(DCS_STRING, 0x1A, A_IGNORE, NORMAL);
+  set1(DCS_STRING, 0x1B, A_IGNORE, CMD_ESCAPE);
+
+  // Malformed OSC sequence, skipped up to BEL, CR, LF or ESC.
+  set(IGNORE_STRING, 0x00, 0xFF, A_IGNORE, IGNORE_STRING);
+  set1(IGNORE_STRING, '\a', A_IGNORE, NORMAL);
+  set1(IGNORE_STRING, '\n', A_IGNORE, NORMAL);
+  set1(IGNORE_STRING, '\r', A_IGNORE, NORMAL);
+  set1(IGNORE_STRING, 0x18, A_IGNORE, NORMAL);
+  set1(IGNORE_STRING, 0x1A, A_IGNORE, NORMAL);
+  set1(IGNORE_STRING, 0x1B, A_EXECUTE, ESCAPE);
+
+  // SOS, PM and APC strings, skipped up to ST.
+  set(SOS_STRING, 0x00, 0xFF, A_IGNORE, SOS_STRING);
+  set1(SOS_STRING, 0x18, A_IGNORE, NORMAL);
+  set1(SOS_STRING, 0x1A, A_IGNORE, NORMAL);
+  set1(SOS_STRING, 0x1B, A_EXECUTE, ESCAPE);
+
+  puts("// Generated by tools/mkparsetab.c. Do not edit.\n");
+  printf("static const uchar parse_table[%u][256] = {\n", STATE_NUM);
+  for (int s = 0; s < STATE_NUM; s++) {
+    printf("  [%s] = {\n", states[s]);
+    for (int c = 0; c < 256; c++) {
+      printf("    %s | %s << 4,\n",
+             actions[table[s][c].action], states[table[s][c].next]);
+    }
+    puts("  },");
+  }
+  puts("};");
+  return 0;
+}
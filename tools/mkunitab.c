@@ -0,0 +1,406 @@
+// mkunitab.c (part of mintty)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+/*
+ * Generates the Unicode character property table used by xcwidth() and
+ * minibidi, see uniprop.h.
+ *
+ * For each code point, the properties are combined into one record, and
+ * records are stored in a two-stage table: the code point's upper bits
+ * select a block of 256 record indexes, and the lower bits select the
+ * index within the block. Identical blocks are stored only once, which
+ * keeps the whole thing down to a few tens of kilobytes.
+ *
+ * Without arguments, the character data comes from unidata.h. Given the
+ * path to a directory containing the Unicode Character Database files
+ * UnicodeData.txt, EastAsianWidth.txt, BidiMirroring.txt and
+ * ArabicShaping.txt, the data is taken from there instead, so moving to a
+ * new Unicode version is just a matter of downloading those and running
+ * 'make UCD=<dir>'.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+typedef unsigned int uint;
+typedef unsigned char uchar;
+
+typedef struct {
+  uint first;
+  uint last;
+} interval;
+
+typedef struct {
+  uint first, last;
+  uchar type;
+} typed_interval;
+
+/* Bidi classes, in the order of the enum in uniprop.h. */
+enum {
+  L, LRE, LRO, R, AL, RLE, RLO, PDF, EN, ES, ET, AN, CS, NSM, BN, B, S, WS, ON,
+  BIDI_NUM
+};
+static const char *bidi_names[] = {
+  "L", "LRE", "LRO", "R", "AL", "RLE", "RLO", "PDF", "EN", "ES", "ET",
+  "AN", "CS", "NSM", "BN", "B", "S", "WS", "ON"
+};
+
+/* Arabic joining types, in the order of the enum in uniprop.h. */
+enum { SL, SR, SD, SU, SC };
+static const char *join_names[] = { "SL", "SR", "SD", "SU", "SC" };
+
+#include "unidata.h"
+
+#define lengthof(array) (sizeof(array) / sizeof(*(array)))
+
+enum { CHAR_NUM = 0x110000, BLOCK_SIZE = 256, BLOCK_NUM = CHAR_NUM / 256 };
+
+typedef struct {
+  int width;
+  bool combining, ambiguous;
+  uchar bidi, join;
+  int mirror;
+} prop;
+
+static prop props[CHAR_NUM];
+
+static bool combining[CHAR_NUM], ambiguous[CHAR_NUM], wide[CHAR_NUM];
+
+
+/* Built-in data */
+
+static void
+set_intervals(bool *flags, const interval *table, uint len)
+{
+  for (uint i = 0; i < len; i++)
+    for (uint c = table[i].first; c <= table[i].last; c++)
+      flags[c] = true;
+}
+
+static void
+load_builtin(void)
+{
+  set_intervals(combining, combining_chars, lengthof(combining_chars));
+  set_intervals(ambiguous, ambiguous_chars, lengthof(ambiguous_chars));
+  set_intervals(wide, wide_chars, lengthof(wide_chars));
+  for (uint i = 0; i < lengthof(bidi_classes); i++)
+    for (uint c = bidi_classes[i].first; c <= bidi_classes[i].last; c++)
+      props[c].bidi = bidi_classes[i].type;
+  for (uint i = 0; i < lengthof(mirror_pairs); i++)
+    props[mirror_pairs[i].from].mirror = mirror_pairs[i].to;
+  for (uint i = 0; i < lengthof(joining_types); i++)
+    for (uint c = joining_types[i].first; c <= joining_types[i].last; c++)
+      props[c].join = joining_types[i].type;
+}
+
+
+/* Unicode Character Database files */
+
+static const char *ucd_dir;
+static const char *ucd_name;
+static uint ucd_line;
+
+static void
+ucd_error(const char *msg)
+{
+  fprintf(stderr, "mkunitab: %s/%s:%u: %s\n", ucd_dir, ucd_name, ucd_line, msg);
+  exit(1);
+}
+
+static FILE *
+ucd_open(const char *name)
+{
+  char path[4096];
+  snprintf(path, sizeof path, "%s/%s", ucd_dir, name);
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    perror(path);
+    exit(1);
+  }
+  ucd_name = name;
+  ucd_line = 0;
+  return f;
+}
+
+/*
+ * Read the next line with data, stripping the comment, and split it into
+ * at most 'max' semicolon-separated fields with surrounding spaces removed.
+ * Returns the number of fields, or 0 at the end of the file.
+ */
+static uint
+ucd_read(FILE *f, char *buf, uint size, char **fields, uint max)
+{
+  while (fgets(buf, size, f)) {
+    ucd_line++;
+    buf[strcspn(buf, "#\r\n")] = 0;
+    if (!buf[strspn(buf, " \t")])
+      continue;
+    uint n = 0;
+    char *s = buf;
+    for (;;) {
+      char *end = s + strcspn(s, ";");
+      bool last = !*end;
+      *end = 0;
+      s += strspn(s, " \t");
+      for (char *t = end; t > s && (t[-1] == ' ' || t[-1] == '\t'); t--)
+        t[-1] = 0;
+      if (n < max)
+        fields[n++] = s;
+      if (last)
+        break;
+      s = end + 1;
+    }
+    return n;
+  }
+  return 0;
+}
+
+/* Parse a code point or a range of code points in the form XXXX..YYYY. */
+static void
+ucd_range(const char *s, uint *first_p, uint *last_p)
+{
+  char *end;
+  *first_p = *last_p = strtoul(s, &end, 16);
+  if (end[0] == '.' && end[1] == '.')
+    *last_p = strtoul(end + 2, &end, 16);
+  if (end == s || *end || *first_p > *last_p || *last_p >= CHAR_NUM)
+    ucd_error("invalid code point");
+}
+
+static void
+load_ucd(void)
+{
+  char buf[1024], *fields[16];
+  uint n;
+
+  // General category and bidi class. Ranges of characters with the same
+  // properties are given as a pair of entries named "<..., First>" and
+  // "<..., Last>".
+  FILE *f = ucd_open("UnicodeData.txt");
+  uint range_start = CHAR_NUM;
+  while ((n = ucd_read(f, buf, sizeof buf, fields, 16))) {
+    if (n < 5)
+      ucd_error("missing fields");
+    uint c, last;
+    ucd_range(fields[0], &c, &last);
+    if (strstr(fields[1], ", First>")) {
+      range_start = c;
+      continue;
+    }
+    if (strstr(fields[1], ", Last>")) {
+      if (range_start > c)
+        ucd_error("range end without start");
+      last = c;
+      c = range_start;
+      range_start = CHAR_NUM;
+    }
+    const char *gc = fields[2];
+    uchar bidi = ON;
+    for (uint i = 0; i < BIDI_NUM; i++) {
+      if (!strcmp(fields[4], bidi_names[i]))
+        bidi = i;
+    }
+    // Classes not listed, i.e. the isolates added in Unicode 6.3, are
+    // treated as ON, because minibidi doesn't know about them.
+    for (; c <= last; c++) {
+      props[c].bidi = bidi;
+      combining[c] = !strcmp(gc, "Mn") || !strcmp(gc, "Me") ||
+                     (!strcmp(gc, "Cf") && c != 0x00AD);
+    }
+  }
+  fclose(f);
+
+  // Hangul Jamo medial vowels and final consonants combine with the
+  // initial consonant, and ZERO WIDTH SPACE is, well, zero width.
+  for (uint c = 0x1160; c <= 0x11FF; c++)
+    combining[c] = true;
+  combining[0x200B] = true;
+
+  f = ucd_open("EastAsianWidth.txt");
+  while ((n = ucd_read(f, buf, sizeof buf, fields, 2))) {
+    if (n < 2)
+      ucd_error("missing fields");
+    uint first, last;
+    ucd_range(fields[0], &first, &last);
+    for (uint c = first; c <= last; c++) {
+      ambiguous[c] = !strcmp(fields[1], "A") && !combining[c];
+      wide[c] = !strcmp(fields[1], "W") || !strcmp(fields[1], "F");
+    }
+  }
+  fclose(f);
+
+  f = ucd_open("BidiMirroring.txt");
+  while ((n = ucd_read(f, buf, sizeof buf, fields, 2))) {
+    if (n < 2)
+      ucd_error("missing fields");
+    uint from, to, unused;
+    ucd_range(fields[0], &from, &unused);
+    ucd_range(fields[1], &to, &unused);
+    props[from].mirror = to;
+  }
+  fclose(f);
+
+  // Only the joining types that minibidi's shaping distinguishes are
+  // recorded. Transparent characters are treated as non-joining.
+  f = ucd_open("ArabicShaping.txt");
+  while ((n = ucd_read(f, buf, sizeof buf, fields, 4))) {
+    if (n < 3)
+      ucd_error("missing fields");
+    uint c, unused;
+    ucd_range(fields[0], &c, &unused);
+    switch (*fields[2]) {
+      case 'L': props[c].join = SL; break;
+      case 'R': props[c].join = SR; break;
+      case 'D': props[c].join = SD; break;
+      case 'C': props[c].join = SC; break;
+    }
+  }
+  fclose(f);
+}
+
+
+/* Table generation */
+
+static prop records[65536];
+static uint record_num;
+
+static uint blocks[BLOCK_NUM][BLOCK_SIZE];
+static uint block_num;
+static uint block_index[BLOCK_NUM];
+
+static bool
+same_prop(const prop *p, const prop *q)
+{
+  return p->width == q->width && p->combining == q->combining &&
+         p->ambiguous == q->ambiguous && p->bidi == q->bidi &&
+         p->join == q->join && p->mirror == q->mirror;
+}
+
+static uint
+add_record(const prop *p)
+{
+  static uint last;
+  if (record_num && same_prop(&records[last], p))
+    return last;
+  for (last = 0; last < record_num; last++) {
+    if (same_prop(&records[last], p))
+      return last;
+  }
+  if (record_num == lengthof(records)) {
+    fputs("mkunitab: too many distinct property records\n", stderr);
+    exit(1);
+  }
+  records[record_num++] = *p;
+  return last;
+}
+
+static uint
+add_block(const uint *block)
+{
+  for (uint i = 0; i < block_num; i++) {
+    if (!memcmp(blocks[i], block, sizeof blocks[i]))
+      return i;
+  }
+  memcpy(blocks[block_num], block, sizeof blocks[block_num]);
+  return block_num++;
+}
+
+static const char *
+elem_type(uint max)
+{
+  return max < 0x100 ? "uchar" : "ushort";
+}
+
+int
+main(int argc, char *argv[])
+{
+  if (argc > 2) {
+    fputs("Usage: mkunitab [UCD-DIR]\n", stderr);
+    return 2;
+  }
+
+  for (uint c = 0; c < CHAR_NUM; c++) {
+    props[c].bidi = ON;
+    props[c].join = SU;
+  }
+  if (argc == 2) {
+    ucd_dir = argv[1];
+    load_ucd();
+  }
+  else
+    load_builtin();
+
+  for (uint c = 0; c < CHAR_NUM; c++) {
+    prop *p = &props[c];
+    if (c == 0)
+      p->width = 0;
+    else if (c < 0x20 || (c >= 0x7F && c < 0xA0))
+      p->width = -1;
+    else if (combining[c])
+      p->width = 0, p->combining = true;
+    else if (ambiguous[c])
+      p->width = 1, p->ambiguous = true;
+    else
+      p->width = wide[c] ? 2 : 1;
+    if (p->mirror) {
+      p->mirror -= c;
+      if (p->mirror < -0x8000 || p->mirror >= 0x8000) {
+        fprintf(stderr, "mkunitab: U+%04X: mirror out of range\n", c);
+        return 1;
+      }
+    }
+  }
+
+  // Record 0 is for code points outside the Unicode range.
+  add_record(&(prop){.width = 1, .bidi = ON, .join = SU});
+
+  for (uint b = 0; b < BLOCK_NUM; b++) {
+    uint block[BLOCK_SIZE];
+    for (uint i = 0; i < BLOCK_SIZE; i++)
+      block[i] = add_record(&props[b * BLOCK_SIZE + i]);
+    block_index[b] = add_block(block);
+  }
+
+  const char *index_type = elem_type(block_num - 1);
+  const char *block_type = elem_type(record_num - 1);
+
+  printf("// Generated by tools/mkunitab.c from %s. Do not edit.\n\n",
+         ucd_dir ? "the Unicode Character Database" : "tools/unidata.h");
+  printf("#define UNITAB_BLOCK_SIZE %u\n\n", BLOCK_SIZE);
+  printf("extern const uniprop unitab_props[%u];\n", record_num);
+  printf("extern const %s unitab_index[%u];\n", index_type, BLOCK_NUM);
+  printf("extern const %s unitab_blocks[%u][%u];\n",
+         block_type, block_num, BLOCK_SIZE);
+
+  puts("\n#ifdef UNITAB_DATA\n");
+
+  printf("const uniprop unitab_props[%u] = {\n", record_num);
+  for (uint i = 0; i < record_num; i++) {
+    prop *p = &records[i];
+    printf("  {%d, %s, %s, %s, %s, %d},\n",
+           p->width, p->combining ? "true" : "false",
+           p->ambiguous ? "true" : "false",
+           bidi_names[p->bidi], join_names[p->join], p->mirror);
+  }
+  puts("};\n");
+
+  printf("const %s unitab_index[%u] = {", index_type, BLOCK_NUM);
+  for (uint b = 0; b < BLOCK_NUM; b++)
+    printf("%s%u,", b % 16 ? " " : "\n  ", block_index[b]);
+  puts("\n};\n");
+
+  printf("const %s unitab_blocks[%u][%u] = {\n",
+         block_type, block_num, BLOCK_SIZE);
+  for (uint b = 0; b < block_num; b++) {
+    printf("  {");
+    for (uint i = 0; i < BLOCK_SIZE; i++)
+      printf("%s%u,", i % 16 ? " " : "\n    ", blocks[b][i]);
+    puts("\n  },");
+  }
+  puts("};\n");
+
+  puts("#endif");
+  return 0;
+}
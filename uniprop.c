@@ -0,0 +1,6 @@
+// uniprop.c (part of mintty)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+// Instantiates the character property table declared in uniprop.h.
+#define UNITAB_DATA
+#include "uniprop.h"
@@ -0,0 +1,43 @@
+#ifndef UNIPROP_H
+#define UNIPROP_H
+
+/*
+ * Unicode character properties, looked up in a table generated by
+ * tools/mkunitab.c.
+ */
+
+/* Bidi classes */
+enum {
+  L, LRE, LRO, R, AL, RLE, RLO, PDF, EN, ES, ET, AN, CS, NSM, BN, B, S, WS, ON
+};
+
+/* Arabic joining types */
+enum {
+  SL,   /* Left-Joining, doesnt exist in U+0600 - U+06FF */
+  SR,   /* Right-Joining, ie has Isolated, Final */
+  SD,   /* Dual-Joining, ie has Isolated, Final, Initial, Medial */
+  SU,   /* Non-Joining */
+  SC    /* Join-Causing, like U+0640 (TATWEEL) */
+};
+
+typedef struct {
+  schar width;     // Column width as per xcwidth(), or -1 for controls
+  bool combining;  // Non-spacing or format character
+  bool ambiguous;  // East Asian Ambiguous width, narrow in width
+  uchar bidi;      // Bidi class
+  uchar join;      // Arabic joining type
+  short mirror;    // Offset to the mirrored character, or 0
+} uniprop;
+
+#include "unitab.h"
+
+static inline const uniprop *
+uniprop_of(xchar c)
+{
+  if (c >= lengthof(unitab_index) * UNITAB_BLOCK_SIZE)
+    return &unitab_props[0];
+  return &unitab_props[unitab_blocks[unitab_index[c / UNITAB_BLOCK_SIZE]]
+                                    [c % UNITAB_BLOCK_SIZE]];
+}
+
+#endif
@@ -234,13 +234,26 @@ win_get_screen_chars(int *rows_p, int *cols_p)
   *cols_p = (fr.right - fr.left) / font_width;
 }
 
+static bool resize_sync;
+static enum { RESIZE_IDLE, RESIZE_BLOCKED, RESIZE_PENDING } resize_state;
+
 void
 win_set_pixels(int height, int width)
 {
+ /*
+  * Size changes requested by the application have to take effect before
+  * the rest of its output is processed, so they bypass the coalescing in
+  * win_adapt_term_size(), along with any change still pending from earlier
+  * if the window size doesn't actually change.
+  */
+  resize_sync = true;
   SetWindowPos(wnd, null, 0, 0,
                width + 2 * PADDING + extra_width,
                height + 2 * PADDING + extra_height,
                SWP_NOACTIVATE | SWP_NOCOPYBITS | SWP_NOMOVE | SWP_NOZORDER);
+  if (resize_state == RESIZE_PENDING)
+    win_adapt_term_size();
+  resize_sync = false;
 }
 
 void
@@ -288,6 +301,42 @@ win_invalidate_all(void)
   InvalidateRect(wnd, null, true);
 }
 
+/*
+ * Resizing. Size changes can arrive in quick succession, for example while
+ * the font is zoomed or the window is maximised. They're coalesced in the
+ * same way as screen updates: the first one is applied straight away,
+ * while later ones within the same frame only record the latest size,
+ * which a timer applies at the end of the frame. So the child sees at most
+ * one such resize per frame, and always the last one. Sizes set through
+ * win_set_pixels() are always applied straight away, though.
+ */
+static int resize_rows, resize_cols;
+
+static void
+apply_resize(void)
+{
+  int rows = resize_rows, cols = resize_cols;
+  if (rows != term.rows || cols != term.cols) {
+    term_resize(rows, cols);
+    struct winsize ws = {rows, cols, cols * font_width, rows * font_height};
+    child_resize(&ws);
+    win_invalidate_all();
+  }
+}
+
+static void
+do_resize(void)
+{
+  if (resize_state == RESIZE_BLOCKED) {
+    resize_state = RESIZE_IDLE;
+    return;
+  }
+
+  resize_state = RESIZE_BLOCKED;
+  apply_resize();
+  win_set_timer(do_resize, 16);
+}
+
 void
 win_adapt_term_size(void)
 {
@@ -304,13 +353,19 @@ win_adapt_term_size(void)
   extra_height = wr.bottom - wr.top - client_height;
   int term_width = client_width - 2 * PADDING;
   int term_height = client_height - 2 * PADDING;
-  int cols = max(1, term_width / font_width);
-  int rows = max(1, term_height / font_height);
-  if (rows != term.rows || cols != term.cols) {
-    term_resize(rows, cols);
-    struct winsize ws = {rows, cols, cols * font_width, rows * font_height};
-    child_resize(&ws);
+  resize_cols = max(1, term_width / font_width);
+  resize_rows = max(1, term_height / font_height);
+  if (resize_state == RESIZE_IDLE) {
+    if (resize_rows != term.rows || resize_cols != term.cols)
+      do_resize();
+  }
+  else if (resize_sync) {
+    // Nothing is left pending for the timer.
+    resize_state = RESIZE_BLOCKED;
+    apply_resize();
   }
+  else
+    resize_state = RESIZE_PENDING;
   win_invalidate_all();
 }
 